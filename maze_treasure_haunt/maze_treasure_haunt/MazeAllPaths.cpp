@@ -0,0 +1,201 @@
+// 全路径枚举：显式栈 DFS + 双连通分量区域限定 + 分支处可达性剪枝
+#include "MazeCore.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+// 标记参与搜索的格子，返回格子数。
+// 剪枝时：从起点做迭代 Tarjan，格子 x 所属的块由其树边决定——low[x] >= disc[父] 时 x 是新块的块首，
+// 否则与父节点同块。起点到终点的简单路径只会经过树上终点到起点链上各格子所在的块
+int MazeSolverCore::markPathRegion(bool prune) {
+    int n = maze.map.size();
+    pathRegion.assign(n, 0);
+    if (!prune) {
+        int cnt = 0;
+        for (int id = 0; id < n; id++)
+            if (isValid(id, workMap)) { pathRegion[id] = 1; cnt++; }
+        return cnt;
+    }
+    bccDisc.assign(n, -1);
+    bccLow.assign(n, 0);
+    bccBlock.assign(n, -1);
+    vector<int>& order = frontier;          // 发现序
+    vector<int>& dirs = frontierNext;       // 栈中各格子下一个要试的方向
+    vector<int>& st = frontierRev;
+    order.clear(); dirs.clear(); st.clear();
+    int t = 0;
+    bccDisc[startId] = bccLow[startId] = t++;
+    order.push_back(startId);
+    st.push_back(startId);
+    dirs.push_back(0);
+    while (!st.empty()) {
+        int u = st.back();
+        int& d = dirs.back();
+        if (d < 4) {
+            int i = d++;
+            int v = u + off[i];
+            if (!isValid(v, workMap)) continue;
+            if (bccDisc[v] < 0) {
+                bccDisc[v] = bccLow[v] = t++;
+                parentDir.set(v, i);
+                order.push_back(v);
+                st.push_back(v);
+                dirs.push_back(0);
+            }else if (u == startId || v != u - off[parentDir.get(u)]) {
+                bccLow[u] = min(bccLow[u], bccDisc[v]);
+            }
+            continue;
+        }
+        st.pop_back();
+        dirs.pop_back();
+        if (u != startId) {
+            int p = u - off[parentDir.get(u)];
+            bccLow[p] = min(bccLow[p], bccLow[u]);
+        }
+    }
+    if (bccDisc[endId] < 0) return 0;
+    for (size_t k = 1; k < order.size(); k++) {
+        int x = order[k];
+        int p = x - off[parentDir.get(x)];
+        bccBlock[x] = (bccLow[x] >= bccDisc[p]) ? x : bccBlock[p];
+    }
+    // 终点到起点链上的块首，其所在块内的格子都参与搜索
+    vector<uint8_t> onChain(n, 0);
+    for (int y = endId; y != startId; y -= off[parentDir.get(y)]) onChain[bccBlock[y]] = 1;
+    int cnt = 1;
+    for (size_t k = 1; k < order.size(); k++) {
+        int x = order[k];
+        if (onChain[bccBlock[x]]) { pathRegion[x] = 1; cnt++; }
+    }
+    pathRegion[startId] = 1;
+    return cnt;
+}
+
+// 格子 u 之后可走的方向（位掩码）。只有一个可走方向时无需检查：u 能到终点则必经此方向。
+// 多个方向时从各候选格子向终点做贪心最佳优先搜索（避开当前路径）：到达终点或碰到已判定可达的
+// 搜索区域即可达；碰到已穷尽仍未到终点的区域即不可达。开阔地带通常只走约两点距离的格子
+uint8_t MazeSolverCore::reachMask(int u, bool prune, AllPathsStats& st) {
+    uint8_t mask = 0;
+    int cand = 0;
+    for (int i = 0; i < 4; i++) {
+        int v = u + off[i];
+        if (pathRegion[v] && workMap[v] != PATH) { mask |= (uint8_t)(1 << i); cand++; }
+    }
+    if (!prune || cand <= 1) return mask;
+    if (reachStamp.size() != pathRegion.size() || reachEpoch > UINT32_MAX - 8) {
+        reachStamp.assign(pathRegion.size(), 0);
+        reachEpoch = 0;
+    }
+    uint32_t first = reachEpoch + 1;
+    bool good[4] = { false, false, false, false };     // 本次第 k 个搜索（戳 first + k）是否到达终点
+    uint8_t result = 0;
+    for (int i = 0; i < 4; i++) {
+        if (!((mask >> i) & 1)) continue;
+        int v = u + off[i];
+        if (reachStamp[v] >= first) {               // 已被本次之前的搜索覆盖，同一连通块
+            if (good[reachStamp[v] - first]) result |= (uint8_t)(1 << i);
+            continue;
+        }
+        st.reachChecks++;
+        uint32_t e = ++reachEpoch;
+        bool ok = v == endId;
+        bool decided = ok;
+        reachOpen.clear();
+        reachOpen.push({ calcH(v), 0, v });
+        reachStamp[v] = e;
+        while (!decided && !reachOpen.empty()) {
+            int cur = reachOpen.pop().id;
+            for (int k = 0; k < 4 && !decided; k++) {
+                int w = cur + off[k];
+                if (!pathRegion[w] || workMap[w] == PATH || reachStamp[w] == e) continue;
+                if (reachStamp[w] >= first) { ok = good[reachStamp[w] - first]; decided = true; break; }
+                if (w == endId) { ok = true; decided = true; break; }
+                reachStamp[w] = e;
+                reachOpen.push({ calcH(w), 0, w });
+            }
+        }
+        good[e - first] = ok;
+        if (ok) result |= (uint8_t)(1 << i);
+    }
+    return result;
+}
+
+AllPathsStats MazeSolverCore::enumeratePaths(const AllPathsOptions& opt, SearchObserver* o) {
+    AllPathsStats st;
+    if (!isReady()) return st;
+    begin(o);
+    if (!endsOpen()) { st.complete = true; return st; }     // 起点或终点在墙上：没有路径
+    auto t0 = chrono::steady_clock::now();
+    auto elapsed = [&]() { return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count(); };
+    st.regionCells = markPathRegion(opt.prune);
+    struct Frame { int cell; uint8_t next, mask; };
+    vector<Frame> stack;
+    vector<pair<int, int>> path;
+    bool stopped = false;
+    if (st.regionCells > 0 && pathRegion[endId]) {
+        workMap.set(startId, PATH);
+        stack.push_back({ startId, 0, startId == endId ? (uint8_t)0 : reachMask(startId, opt.prune, st) });
+        st.steps++;
+    }
+    while (!stack.empty() && !stopped) {
+        Frame& f = stack.back();
+        int u = f.cell;
+        if (u == endId) {
+            st.paths++;
+            res.found = true;
+            if (obs) obs->onPathFound((int)min(st.paths, (long long)INT32_MAX));
+            if (opt.onPath) {
+                path.clear();
+                for (const Frame& e : stack) path.push_back({ maze.map.toX(e.cell), maze.map.toY(e.cell) });
+                if (!opt.onPath(path)) stopped = true;
+            }
+            if (opt.limit > 0 && st.paths >= opt.limit) stopped = true;
+        }
+        int i = f.next;
+        while (i < 4 && !((f.mask >> i) & 1)) i++;
+        if (u == endId || i == 4) {
+            // 回溯
+            workMap.set(u, ROAD);
+            stack.pop_back();
+            if (obs && u != startId) {
+                obs->onStepOut(maze.map.toX(u), maze.map.toY(u));
+                obs->onStats((int)min(st.steps, (long long)INT32_MAX), (int)stack.size() - 1);
+            }
+            continue;
+        }
+        f.next = (uint8_t)(i + 1);
+        int v = u + off[i];
+        if (workMap[v] == PATH) continue;   // 掩码计算后路径未变，这里只是保险
+        workMap.set(v, PATH);
+        st.steps++;
+        int vx = maze.map.toX(v), vy = maze.map.toY(v);
+        if (obs) {
+            obs->onStats((int)min(st.steps, (long long)INT32_MAX), (int)stack.size());
+            if (v != endId) obs->onStepIn(vx, vy);
+        }
+        long long checks = st.reachChecks;
+        stack.push_back({ v, 0, v == endId ? (uint8_t)0 : reachMask(v, opt.prune, st) });
+        bool probe = (st.steps & 255) == 0 || st.reachChecks != checks;
+        if (opt.timeBudgetMs > 0 && probe && elapsed() > opt.timeBudgetMs) {
+            st.timedOut = true;
+            stopped = true;
+        }
+    }
+    // 提前结束时把栈上格子恢复为通路
+    for (const Frame& e : stack) workMap.set(e.cell, ROAD);
+    st.complete = !stopped;
+    st.ms = elapsed();
+    return st;
+}
+
+// 寻找所有路径：以 limit 为上限的全路径枚举
+SolveResult MazeSolverCore::solveAllPaths(SearchObserver* o, int limit) {
+    if (!isReady()) return SolveResult();
+    AllPathsOptions opt;
+    opt.limit = limit;
+    AllPathsStats st = enumeratePaths(opt, o);
+    res.pathCount = (int)min(st.paths, (long long)INT32_MAX);
+    res.visitedCount = (int)min(st.steps, (long long)INT32_MAX);
+    return res;
+}
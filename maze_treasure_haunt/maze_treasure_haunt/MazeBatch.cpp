@@ -0,0 +1,104 @@
+// 批量寻路：每线程一份缓冲区，访问标记用代数戳代替每次复制地图
+#include "MazeBatch.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+void MazeBatchSolver::setMaze(const MazeData& m) {
+    map = m.map;
+    map.neighborOffsets(off);
+    scratch.clear();
+}
+
+// 代数加一即清空全部访问标记；回绕时才真正清零
+void MazeBatchSolver::prepare(Scratch& s) {
+    if ((int)s.stamp.size() != map.size()) {
+        s.stamp.assign(map.size(), 0);
+        s.g.resize(map.size());
+        s.parentDir.resize(map.size());
+        s.gen = 0;
+    }
+    if (++s.gen >= 0x7fffffffu) {
+        fill(s.stamp.begin(), s.stamp.end(), 0);
+        s.gen = 1;
+    }
+}
+
+// 桶队列 A*，与 MazeSolverCore::solveAStar(OPEN_BUCKET) 相同的出队顺序
+void MazeBatchSolver::solveOne(Scratch& s, const MazeQuery& q, QueryResult& r) {
+    r = QueryResult();
+    if (!map.inside(q.startX, q.startY) || !map.inside(q.endX, q.endY)) return;
+    int startId = map.id(q.startX, q.startY), endId = map.id(q.endX, q.endY);
+    if (map[startId] == WALL || map[endId] == WALL) return;
+    prepare(s);
+    const uint32_t OPEN = s.gen * 2, CLOSED = s.gen * 2 + 1;
+    auto calcH = [&](int id) { return abs(map.toX(id) - q.endX) + abs(map.toY(id) - q.endY); };
+    s.open.clear(calcH(startId));
+    s.open.push({ calcH(startId), 0, startId });
+    s.g[startId] = 0;
+    s.stamp[startId] = OPEN;
+    while (!s.open.empty()) {
+        OpenEntry cur = s.open.pop();
+        if (s.stamp[cur.id] == CLOSED || cur.g > s.g[cur.id]) continue;
+        ++r.visitedCount;
+        if (cur.id == endId) { r.found = true; break; }
+        s.stamp[cur.id] = CLOSED;
+        for (int i = 0; i < 4; i++) {
+            int nid = cur.id + off[i];
+            if (map[nid] == WALL) continue;
+            uint32_t st = s.stamp[nid];
+            if (st == CLOSED) continue;
+            int newG = cur.g + 1;
+            if (st == OPEN && newG >= s.g[nid]) continue;
+            s.stamp[nid] = OPEN;
+            s.g[nid] = newG;
+            s.parentDir.set(nid, i);
+            s.open.push({ newG + calcH(nid), newG, nid });
+        }
+    }
+    if (!r.found) return;
+    r.pathLen = s.g[endId] + 1;
+    if (!keepPaths) return;
+    s.pathIds.clear();
+    for (int cur = endId; ; cur -= off[s.parentDir.get(cur)]) {
+        s.pathIds.push_back(cur);
+        if (cur == startId) break;
+    }
+    r.path.reserve(s.pathIds.size());
+    for (auto it = s.pathIds.rbegin(); it != s.pathIds.rend(); ++it) r.path.push_back({ map.toX(*it), map.toY(*it) });
+}
+
+BatchStats MazeBatchSolver::run(const vector<MazeQuery>& queries, vector<QueryResult>& out) {
+    BatchStats st;
+    st.queries = (int)queries.size();
+    out.resize(queries.size());
+    if (map.empty() || queries.empty()) return st;
+    int workers = pool.size();
+    if ((int)scratch.size() < workers) scratch.resize(workers);
+    atomic<int> next{ 0 };
+    auto t0 = chrono::steady_clock::now();
+    // 每个任务绑定一份缓冲区，从共享计数器领取查询
+    pool.run(workers, [&](int w) {
+        Scratch& s = scratch[w];
+        int i;
+        while ((i = next.fetch_add(1)) < (int)queries.size()) {
+            auto q0 = chrono::steady_clock::now();
+            solveOne(s, queries[i], out[i]);
+            out[i].micros = chrono::duration<double, micro>(chrono::steady_clock::now() - q0).count();
+        }
+    });
+    st.totalMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+
+    vector<double> lat(queries.size());
+    double sum = 0;
+    for (size_t i = 0; i < out.size(); i++) { lat[i] = out[i].micros; sum += lat[i]; }
+    sort(lat.begin(), lat.end());
+    auto pct = [&](double p) { return lat[min(lat.size() - 1, (size_t)(p * (lat.size() - 1) + 0.5))]; };
+    st.p50 = pct(0.50);
+    st.p90 = pct(0.90);
+    st.p99 = pct(0.99);
+    st.maxUs = lat.back();
+    st.meanUs = sum / lat.size();
+    return st;
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+// 批量寻路：同一张地图上的大量 (起点, 终点) 查询，多线程并行，统计单次延迟分位数
+#include "MazeCore.h"
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+struct MazeQuery {
+    int startX, startY, endX, endY;
+};
+
+struct QueryResult {
+    bool found = false;
+    int pathLen = 0;
+    int visitedCount = 0;
+    double micros = 0;      // 单次查询耗时（微秒）
+    std::vector<std::pair<int, int>> path;   // 仅在 setKeepPaths(true) 时填写
+};
+
+// 延迟统计（微秒），totalMs 为整批墙钟时间
+struct BatchStats {
+    int queries = 0;
+    double totalMs = 0;
+    double p50 = 0, p90 = 0, p99 = 0, maxUs = 0, meanUs = 0;
+};
+
+class MazeBatchSolver {
+private:
+    // 每个线程一份的搜索缓冲区，跨查询复用
+    struct Scratch {
+        std::vector<uint32_t> stamp;   // 2*gen：g 值有效；2*gen+1：已关闭；其余视为未访问
+        std::vector<int> g;
+        ParentDirs parentDir;
+        BucketQueue open;
+        std::vector<int> pathIds;
+        uint32_t gen = 0;
+    };
+
+    MazeGrid map;
+    int off[4] = { 0, 0, 0, 0 };
+    std::vector<Scratch> scratch;
+    ThreadPool pool;
+    bool keepPaths = false;
+
+    void prepare(Scratch& s);
+    void solveOne(Scratch& s, const MazeQuery& q, QueryResult& r);
+
+public:
+    MazeBatchSolver() {}
+    MazeBatchSolver(const MazeBatchSolver&) = delete;
+    MazeBatchSolver& operator=(const MazeBatchSolver&) = delete;
+
+    void setMaze(const MazeData& m);
+    void setThreads(int n) { pool.resize(n); }
+    int threads() const { return pool.size(); }
+    void setKeepPaths(bool keep) { keepPaths = keep; }
+
+    // 起点或终点越界、是墙的查询直接返回 found = false
+    BatchStats run(const std::vector<MazeQuery>& queries, std::vector<QueryResult>& out);
+};
@@ -0,0 +1,1024 @@
+// 性能基准：maze_bench <子命令> [参数...]
+#include "MazeCore.h"
+#include "MazeBatch.h"
+#include "MazeBinary.h"
+#include "MazeDStar.h"
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <queue>
+#include <random>
+#include <algorithm>
+#include <climits>
+#include <thread>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static double nowMs() {
+    return chrono::duration<double, milli>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 进程峰值常驻内存（MB，不可用时返回 -1）
+static double peakRssMb() {
+#ifdef __linux__
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0) return ru.ru_maxrss / 1024.0;
+#endif
+    return -1;
+}
+
+// 硬件缓存未命中计数（Linux perf_event，不可用时返回 -1）
+class CacheMissCounter {
+private:
+    int fd = -1;
+public:
+    CacheMissCounter() {
+#ifdef __linux__
+        perf_event_attr pe;
+        memset(&pe, 0, sizeof(pe));
+        pe.type = PERF_TYPE_HARDWARE;
+        pe.size = sizeof(pe);
+        pe.config = PERF_COUNT_HW_CACHE_MISSES;
+        pe.disabled = 1;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+        fd = (int)syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+#endif
+    }
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (fd >= 0) close(fd);
+#endif
+    }
+    void start() {
+#ifdef __linux__
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+    long long stop() {
+#ifdef __linux__
+        if (fd < 0) return -1;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long v = 0;
+        if (read(fd, &v, sizeof(v)) != sizeof(v)) return -1;
+        return v;
+#else
+        return -1;
+#endif
+    }
+};
+
+static void printRow(const char* name, double ms, long long work, long long misses, long long bytes) {
+    char missBuf[32];
+    if (misses >= 0) snprintf(missBuf, sizeof(missBuf), "%lld", misses);
+    else snprintf(missBuf, sizeof(missBuf), "n/a");
+    printf("  %-22s %10.2f ms %10.1f Mcell/s %14s miss %8.1f MB(地图)\n",
+        name, ms, work / ms / 1000.0, missBuf, bytes / 1048576.0);
+}
+
+// 旧布局：vector<vector<int>>，每次探测需越界判断
+static long long legacyBFS(const MazeData& m, int& dist) {
+    vector<vector<int>> work(m.rows, vector<int>(m.cols));
+    for (int i = 0; i < m.rows; i++)
+        for (int j = 0; j < m.cols; j++) work[i][j] = m.map.at(i, j);
+    const int dx[4] = { 0, 1, 0, -1 };
+    const int dy[4] = { 1, 0, -1, 0 };
+    queue<pair<int, int>> q;
+    vector<vector<int>> d(m.rows, vector<int>(m.cols, -1));
+    q.push({ m.startX, m.startY });
+    work[m.startX][m.startY] = VISITED;
+    d[m.startX][m.startY] = 0;
+    long long expanded = 0;
+    while (!q.empty()) {
+        auto cur = q.front(); q.pop();
+        expanded++;
+        for (int i = 0; i < 4; i++) {
+            int nx = cur.first + dx[i], ny = cur.second + dy[i];
+            if (nx >= 0 && nx < m.rows && ny >= 0 && ny < m.cols && work[nx][ny] != WALL && work[nx][ny] != VISITED) {
+                work[nx][ny] = VISITED;
+                d[nx][ny] = d[cur.first][cur.second] + 1;
+                q.push({ nx, ny });
+            }
+        }
+    }
+    dist = d[m.endX][m.endY];
+    return expanded;
+}
+
+// 新布局：连续 uint8_t 网格 + 哨兵墙，按格子编号扩展
+static long long flatBFS(const MazeData& m, int& dist) {
+    MazeGrid work = m.map;
+    int off[4];
+    work.neighborOffsets(off);
+    vector<int> q(work.size());
+    vector<int> d(work.size(), -1);
+    int head = 0, tail = 0;
+    int s = work.id(m.startX, m.startY);
+    q[tail++] = s;
+    work[s] = VISITED;
+    d[s] = 0;
+    while (head < tail) {
+        int cur = q[head++];
+        for (int i = 0; i < 4; i++) {
+            int nid = cur + off[i];
+            if (work[nid] == ROAD) {
+                work[nid] = VISITED;
+                d[nid] = d[cur] + 1;
+                q[tail++] = nid;
+            }
+        }
+    }
+    dist = d[work.id(m.endX, m.endY)];
+    return head;
+}
+
+// 开阔房间地图：room x room 的房间以单格墙分隔，每面墙开一个门，房间内散布少量障碍
+static void makeRoomsMap(MazeData& m, int n, int room, int obstaclePercent, unsigned seed) {
+    mt19937 rng(seed);
+    m.rows = m.cols = n;
+    m.map.assign(n, n, ROAD);
+    int step = room + 1;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+            if (i % step == room || j % step == room) m.map.at(i, j) = WALL;
+            else if ((int)(rng() % 100) < obstaclePercent) m.map.at(i, j) = WALL;
+        }
+    // 每个房间向右、向下各开一扇宽 2 的门
+    for (int r = 0; r * step < n; r++)
+        for (int c = 0; c * step < n; c++) {
+            int top = r * step, left = c * step;
+            int wx = left + room, wy = top + room;
+            int h = min(room, n - top), w = min(room, n - left);
+            int d1 = top + (int)(rng() % max(1, h - 1)), d2 = left + (int)(rng() % max(1, w - 1));
+            for (int k = 0; k < 2; k++) {
+                if (wx < n && d1 + k < n) m.map.at(d1 + k, wx) = ROAD;
+                if (wy < n && d2 + k < n) m.map.at(wy, d2 + k) = ROAD;
+            }
+        }
+    m.startX = 0; m.startY = 0;
+    m.endX = n - 1; m.endY = n - 1;
+    m.map.at(0, 0) = ROAD;
+    m.map.at(n - 1, n - 1) = ROAD;
+}
+
+// 旧 A*：priority_queue 惰性删除，统计过期条目出队数
+static long long legacyAStar(const MazeData& m, long long& stalePops, int& pathLen) {
+    struct E { int f, g, id; bool operator>(const E& o) const { return f > o.f; } };
+    const MazeGrid& g = m.map;
+    int off[4];
+    g.neighborOffsets(off);
+    vector<uint8_t> closed(g.size(), 0);
+    vector<int> minG(g.size(), INT_MAX);
+    priority_queue<E, vector<E>, greater<E>> pq;
+    int s = g.id(m.startX, m.startY), t = g.id(m.endX, m.endY);
+    auto h = [&](int id) { return abs(g.toX(id) - m.endX) + abs(g.toY(id) - m.endY); };
+    pq.push({ h(s), 0, s });
+    minG[s] = 0;
+    long long pops = 0;
+    stalePops = 0;
+    pathLen = 0;
+    while (!pq.empty()) {
+        E cur = pq.top(); pq.pop();
+        pops++;
+        if (closed[cur.id]) { stalePops++; continue; }
+        if (cur.id == t) { pathLen = cur.g + 1; break; }
+        closed[cur.id] = 1;
+        for (int i = 0; i < 4; i++) {
+            int nid = cur.id + off[i];
+            if (g[nid] == WALL) continue;
+            int ng = cur.g + 1;
+            if (ng < minG[nid]) { minG[nid] = ng; pq.push({ ng + h(nid), ng, nid }); }
+        }
+    }
+    return pops;
+}
+
+// A* 开放表对比：惰性 priority_queue / 索引堆 / 桶队列
+static void benchAStar(const vector<int>& sizes) {
+    printf("== astar: priority_queue(惰性删除) vs IndexedHeap(decrease-key) vs BucketQueue(Dial) ==\n");
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            long long stale = 0;
+            int len1 = 0;
+            double t0 = nowMs();
+            long long pops = legacyAStar(m, stale, len1);
+            double ms1 = nowMs() - t0;
+            printf("  %-14s %10.2f ms  pathLen %8d  pops %10lld  过期出队 %lld\n", "priority_queue", ms1, len1, pops, stale);
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            t0 = nowMs();
+            SolveResult r = solver.solveAStar();
+            double ms2 = nowMs() - t0;
+            printf("  %-14s %10.2f ms  pathLen %8d  pops %10d  decrease-key %d（避免的重复出队）\n",
+                "IndexedHeap", ms2, r.pathLen, r.visitedCount, r.decreaseKeys);
+            t0 = nowMs();
+            SolveResult rb = solver.solveAStar(nullptr, OPEN_BUCKET);
+            double ms3 = nowMs() - t0;
+            printf("  %-14s %10.2f ms  pathLen %8d  pops %10d  %8.1f Mnode/s\n",
+                "BucketQueue", ms3, rb.pathLen, rb.visitedCount, rb.visitedCount / ms3 / 1000.0);
+        }
+    }
+}
+
+// 单向与双向搜索对比
+static void benchBidir(const vector<int>& sizes) {
+    printf("== bidir: BFS / A* 单向 vs 双向 ==\n");
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            const char* names[4] = { "BFS", "BiBFS", "A*", "BiA*" };
+            for (int k = 0; k < 4; k++) {
+                double t0 = nowMs();
+                SolveResult r = (k == 0) ? solver.solveBFS() : (k == 1) ? solver.solveBiBFS()
+                    : (k == 2) ? solver.solveAStar() : solver.solveBiAStar();
+                double ms = nowMs() - t0;
+                printf("  %-6s %10.2f ms  pathLen %9d  visited %10d\n", names[k], ms, r.pathLen, r.visitedCount);
+            }
+        }
+    }
+}
+
+// A* 与跳点搜索对比：visited 为出队扩展的节点数（JPS 只计跳点）
+static void benchJps(const vector<int>& sizes) {
+    printf("== jps: A* vs 跳点搜索 ==\n");
+    for (int n : sizes) {
+        for (int kind = 0; kind < 3; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, kind == 1 ? 0 : 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : kind == 1 ? "房间地图(32x32, 无障碍)" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            const char* names[2] = { "A*", "JPS" };
+            for (int k = 0; k < 2; k++) {
+                double t0 = nowMs();
+                SolveResult r = (k == 0) ? solver.solveAStar() : solver.solveJPS();
+                double ms = nowMs() - t0;
+                printf("  %-6s %10.2f ms  pathLen %9d  visited %10d\n", names[k], ms, r.pathLen, r.visitedCount);
+            }
+        }
+    }
+}
+
+// 逐格出队 BFS 与位并行 BFS 对比
+static void benchBitBfs(const vector<int>& sizes) {
+    printf("== bitbfs: 队列 BFS vs 位并行 BFS ==\n");
+    for (int n : sizes) {
+        for (int kind = 0; kind < 3; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, kind == 1 ? 0 : 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : kind == 1 ? "房间地图(32x32, 无障碍)" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            const char* names[2] = { "queue", "bitset" };
+            for (int k = 0; k < 2; k++) {
+                double t0 = nowMs();
+                SolveResult r = solver.solveBFS(nullptr, k == 0 ? BFS_QUEUE : BFS_BITSET);
+                double ms = nowMs() - t0;
+                printf("  %-6s %10.2f ms  pathLen %9d  visited %10d\n", names[k], ms, r.pathLen, r.visitedCount);
+            }
+            // 全图连通判定：队列 BFS 跑满全图 vs 位并行整行填充
+            int dist = 0;
+            double t0 = nowMs();
+            long long cnt = flatBFS(m, dist);
+            double ms1 = nowMs() - t0;
+            t0 = nowMs();
+            int cnt2 = solver.countReachable();
+            double ms2 = nowMs() - t0;
+            printf("  全图可达  queue %8.2f ms / bitset %8.2f ms  格子数 %lld / %d\n", ms1, ms2, cnt, cnt2);
+        }
+    }
+}
+
+// 多线程 BFS 线程数扩展：与单线程 BFS 的路径逐格比对
+static void benchParallelBfs(const vector<int>& sizes) {
+    int hw = (int)thread::hardware_concurrency();
+    printf("== pbfs: 单线程 BFS vs 多线程按层 BFS（CPU 核数 %d）==\n", hw);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            double t0 = nowMs();
+            SolveResult base = solver.solveBFS();
+            double ms0 = nowMs() - t0;
+            printf("  %-10s %10.2f ms  pathLen %9d  visited %10d\n", "queue", ms0, base.pathLen, base.visitedCount);
+            for (int t = 1; t <= max(hw, 4); t *= 2) {
+                solver.setThreads(t);
+                t0 = nowMs();
+                SolveResult r = solver.solveBFS(nullptr, BFS_PARALLEL);
+                double ms = nowMs() - t0;
+                printf("  %2d 线程    %10.2f ms  pathLen %9d  visited %10d  加速 %.2fx  路径%s\n", t, ms, r.pathLen,
+                    r.visitedCount, ms0 / ms, r.path == base.path ? "一致" : "不一致");
+            }
+        }
+    }
+}
+
+// 批量查询：逐个 setMaze + solveAStar vs MazeBatchSolver（缓冲区复用 + 线程池）
+static void benchBatch(const vector<int>& sizes) {
+    const int QUERIES = 1000;
+    int hw = (int)thread::hardware_concurrency();
+    printf("== batch: %d 个随机 (起点, 终点) 查询，延迟单位微秒 ==\n", QUERIES);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            mt19937 rng(2024u);
+            auto road = [&](int& x, int& y) {
+                do { x = (int)(rng() % m.rows); y = (int)(rng() % m.cols); } while (m.map.at(x, y) == WALL);
+            };
+            vector<MazeQuery> qs(QUERIES);
+            for (auto& q : qs) { road(q.startX, q.startY); road(q.endX, q.endY); }
+
+            // 旧方式：每个查询改起终点后重新 setMaze
+            vector<int> lens(QUERIES);
+            vector<double> lat(QUERIES);
+            MazeSolverCore solver;
+            double t0 = nowMs();
+            for (int i = 0; i < QUERIES; i++) {
+                double q0 = nowMs();
+                MazeData one = m;
+                one.startX = qs[i].startX; one.startY = qs[i].startY;
+                one.endX = qs[i].endX; one.endY = qs[i].endY;
+                solver.setMaze(one);
+                lens[i] = solver.solveAStar(nullptr, OPEN_BUCKET).pathLen;
+                lat[i] = (nowMs() - q0) * 1000.0;
+            }
+            double ms0 = nowMs() - t0;
+            sort(lat.begin(), lat.end());
+            printf("  %-14s %10.2f ms  p50 %9.1f  p90 %9.1f  p99 %9.1f  max %9.1f\n", "setMaze+solve", ms0,
+                lat[QUERIES / 2], lat[QUERIES * 9 / 10], lat[QUERIES * 99 / 100], lat.back());
+
+            MazeBatchSolver batch;
+            batch.setMaze(m);
+            for (int t = 1; t <= max(hw, 4); t *= 2) {
+                batch.setThreads(t);
+                vector<QueryResult> out;
+                BatchStats st = batch.run(qs, out);
+                int diff = 0;
+                for (int i = 0; i < QUERIES; i++) if (out[i].pathLen != lens[i]) diff++;
+                char name[32];
+                snprintf(name, sizeof(name), "batch %d 线程", t);
+                printf("  %-14s %10.2f ms  p50 %9.1f  p90 %9.1f  p99 %9.1f  max %9.1f  %.0f 查询/s  路径长度不一致 %d\n",
+                    name, st.totalMs, st.p50, st.p90, st.p99, st.maxUs, QUERIES / st.totalMs * 1000.0, diff);
+            }
+        }
+    }
+}
+
+// 线程池：每轮先 resize 再 run，检查 run 返回时每个任务恰好执行一次（新建线程不得误认旧轮次）
+static void benchPool(const vector<int>& rounds) {
+    const int TASKS = 64;
+    int hw = max((int)thread::hardware_concurrency(), 4);
+    printf("== pool: 每轮 resize(1..%d) 后 run(%d) ==\n", hw, TASKS);
+    for (int n : rounds) {
+        ThreadPool pool;
+        vector<int> hits(TASKS);
+        int bad = 0;
+        double t0 = nowMs();
+        for (int r = 0; r < n; r++) {
+            pool.resize(1 + r % hw);
+            fill(hits.begin(), hits.end(), 0);
+            pool.run(TASKS, [&](int i) {
+                volatile int spin = 0;
+                for (int k = 0; k < 200; k++) spin = spin + k;
+                hits[i]++;
+            });
+            for (int h : hits) if (h != 1) { bad++; break; }
+        }
+        double ms = nowMs() - t0;
+        printf("  %8d 轮 %10.2f ms  每轮 %8.2f us  出错轮数 %d\n", n, ms, ms * 1000.0 / n, bad);
+    }
+}
+
+// 大地图上的短查询：求解前的重置只推进代数，与旧的整图复制 + G 表填充对比
+static void benchReset(const vector<int>& sizes) {
+    const int REPS = 1000;
+    printf("== reset: 大地图短查询（起终点相距约 20 格），每次求解平均耗时 ==\n");
+    for (int n : sizes) {
+        MazeData m;
+        makeRoomsMap(m, n, 32, 10, 12345u);
+        m.startX = 1; m.startY = 1; m.endX = 12; m.endY = 12;
+        m.map.at(m.startX, m.startY) = ROAD;
+        m.map.at(m.endX, m.endY) = ROAD;
+        printf("%dx%d 房间地图\n", n, n);
+        // 旧 reset 的开销：workMap = mazeMap 整图复制 + minG 整表填充
+        double t0 = nowMs();
+        long long sink = 0;
+        for (int i = 0; i < 10; i++) {
+            MazeGrid copy = m.map;
+            vector<int> minG(copy.size(), INT_MAX);
+            sink += copy[i] + minG[i];
+        }
+        double oldUs = (nowMs() - t0) * 1000.0 / 10;
+        printf("  旧 reset（复制地图 + 填充 G 表） %10.1f us%s\n", oldUs, sink == 42 ? " " : "");
+        MazeSolverCore solver;
+        solver.setMaze(m);
+        const char* names[3] = { "BFS", "A*", "JPS" };
+        solver.solveAStar();   // G 值表首次使用时分配，不计入
+        for (int k = 0; k < 3; k++) {
+            SolveResult r;
+            t0 = nowMs();
+            for (int i = 0; i < REPS; i++)
+                r = (k == 0) ? solver.solveBFS() : (k == 1) ? solver.solveAStar() : solver.solveJPS();
+            double us = (nowMs() - t0) * 1000.0 / REPS;
+            printf("  %-4s 每次求解 %10.1f us  pathLen %4d  visited %6d\n", names[k], us, r.pathLen, r.visitedCount);
+        }
+    }
+}
+
+// 同一终点、大量起点：逐个 A* 查询 vs 终点距离场（建一次，之后贪心下降）
+static void benchField(const vector<int>& sizes) {
+    const int QUERIES = 1000;
+    printf("== field: %d 个随机起点到同一终点 ==\n", QUERIES);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            mt19937 rng(77u);
+            vector<MazeQuery> qs(QUERIES);
+            for (auto& q : qs) {
+                do { q.startX = (int)(rng() % m.rows); q.startY = (int)(rng() % m.cols); } while (m.map.at(q.startX, q.startY) == WALL);
+                q.endX = m.endX; q.endY = m.endY;
+            }
+            MazeBatchSolver batch;
+            batch.setMaze(m);
+            vector<QueryResult> out;
+            BatchStats st = batch.run(qs, out);
+            printf("  %-16s %10.2f ms  p50 %9.1f us\n", "A* 逐个查询", st.totalMs, st.p50);
+
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            double t0 = nowMs();
+            solver.distanceToEnd(m.startX, m.startY);
+            double build = nowMs() - t0;
+            int diff = 0;
+            t0 = nowMs();
+            for (int i = 0; i < QUERIES; i++) {
+                SolveResult r = solver.solveDistField(qs[i].startX, qs[i].startY);
+                if (r.pathLen != out[i].pathLen) diff++;
+            }
+            double ms = nowMs() - t0;
+            printf("  %-16s %10.2f ms  （建场 %.2f ms + 下降 %.2f ms，平均 %.1f us/查询）  路径长度不一致 %d\n",
+                "距离场", build + ms, build, ms, ms * 1000.0 / QUERIES, diff);
+            // 同样内容的地图再次 setMaze（如重新加载同一文件）时缓存仍然有效
+            solver.setMaze(m);
+            printf("  重新 setMaze 相同地图后缓存%s\n", solver.distFieldCached() ? "命中" : "失效");
+        }
+    }
+}
+
+// 走廊收缩：建图一次，之后在小图上求解
+static void benchCorridor(const vector<int>& sizes) {
+    printf("== corridor: 格子级 BFS / A* vs 走廊收缩图 A* ==\n");
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            const char* names[2] = { "BFS", "A*" };
+            for (int k = 0; k < 2; k++) {
+                double t0 = nowMs();
+                SolveResult r = (k == 0) ? solver.solveBFS() : solver.solveAStar();
+                double ms = nowMs() - t0;
+                printf("  %-10s %10.2f ms  pathLen %9d  visited %10d\n", names[k], ms, r.pathLen, r.visitedCount);
+            }
+            double t0 = nowMs();
+            SolveResult first = solver.solveCorridor();
+            double ms1 = nowMs() - t0;
+            t0 = nowMs();
+            SolveResult again = solver.solveCorridor();
+            double ms2 = nowMs() - t0;
+            const CorridorGraph& g = solver.corridorGraph();
+            long long roads = 0;
+            for (int i = 0; i < m.rows; i++) for (int j = 0; j < m.cols; j++) roads += m.map.at(i, j) != WALL;
+            printf("  %-10s %10.2f ms  pathLen %9d  visited %10d  （含建图）\n", "corridor", ms1, first.pathLen, first.visitedCount);
+            printf("  %-10s %10.2f ms  pathLen %9d  visited %10d  （已缓存）\n", "corridor", ms2, again.pathLen, again.visitedCount);
+            printf("  收缩图: %d 节点 / %d 有向边，通路格子 %lld，节点占 %.1f%%\n", g.nodeCount(), g.arcCount(), roads,
+                100.0 * g.nodeCount() / roads);
+        }
+    }
+}
+
+// 死胡同填充前后 DFS / BFS / A* 对比
+static void benchDeadEnd(const vector<int>& sizes) {
+    printf("== deadend: 死胡同填充剪枝 ==\n");
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            const char* names[3] = { "DFS", "BFS", "A*" };
+            double before[3];
+            for (int k = 0; k < 3; k++) {
+                double t0 = nowMs();
+                SolveResult r = (k == 0) ? solver.solveDFS() : (k == 1) ? solver.solveBFS() : solver.solveAStar();
+                before[k] = nowMs() - t0;
+                printf("  %-4s 填充前 %10.2f ms  pathLen %9d  visited %10d\n", names[k], before[k], r.pathLen, r.visitedCount);
+            }
+            DeadEndStats st = solver.fillDeadEnds();
+            printf("  填充 %d / %d 个通路格子（%.1f%%），耗时 %.2f ms\n", st.filledCells, st.roadCells,
+                100.0 * st.filledCells / st.roadCells, st.ms);
+            for (int k = 0; k < 3; k++) {
+                double t0 = nowMs();
+                SolveResult r = (k == 0) ? solver.solveDFS() : (k == 1) ? solver.solveBFS() : solver.solveAStar();
+                double ms = nowMs() - t0;
+                printf("  %-4s 填充后 %10.2f ms  pathLen %9d  visited %10d  加速 %.2fx（计入填充 %.2fx）\n", names[k], ms,
+                    r.pathLen, r.visitedCount, before[k] / ms, before[k] / (ms + st.ms));
+            }
+        }
+    }
+}
+
+// 随机 (起点, 终点) 查询：平面 A*（批量求解器，单线程）vs HPA*，以及单格修改后的按簇重建
+static void benchHpa(const vector<int>& sizes) {
+    const int QUERIES = 200;
+    printf("== hpa: %d 个随机查询，平面 A* vs HPA*（32x32 簇） ==\n", QUERIES);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            mt19937 rng(2024u);
+            auto road = [&](int& x, int& y) {
+                do { x = (int)(rng() % m.rows); y = (int)(rng() % m.cols); } while (m.map.at(x, y) == WALL);
+            };
+            vector<MazeQuery> qs(QUERIES);
+            for (auto& q : qs) { road(q.startX, q.startY); road(q.endX, q.endY); }
+
+            MazeBatchSolver batch;
+            batch.setMaze(m);
+            vector<QueryResult> ref;
+            BatchStats bs = batch.run(qs, ref);
+            long long refVisited = 0;
+            for (auto& r : ref) refVisited += r.visitedCount;
+            printf("  %-10s %10.2f ms  平均扩展 %10.1f\n", "A*", bs.totalMs, (double)refVisited / QUERIES);
+
+            HpaGraph hpa;
+            double t0 = nowMs();
+            hpa.build(m.map);
+            double buildMs = nowMs() - t0;
+            printf("  抽象建立 %.2f ms：%d 簇，%d 入口节点，%d 条边\n", buildMs, hpa.clusterCount(), hpa.nodeCount(), hpa.edgeCount());
+            vector<int> path;
+            long long expanded = 0, refine = 0, lenSum = 0, refSum = 0;
+            int missing = 0, longer = 0;
+            t0 = nowMs();
+            for (int i = 0; i < QUERIES; i++) {
+                HpaQueryStats st;
+                bool ok = hpa.findPath(qs[i].startX, qs[i].startY, qs[i].endX, qs[i].endY, path, &st);
+                expanded += st.expanded;
+                refine += st.refineCells;
+                if (ok != ref[i].found) missing++;
+                if (!ok || !ref[i].found) continue;
+                lenSum += (long long)path.size();
+                refSum += ref[i].pathLen;
+                if ((int)path.size() > ref[i].pathLen) longer++;
+            }
+            double qMs = nowMs() - t0;
+            printf("  %-10s %10.2f ms  平均扩展 %10.1f  细化格子 %10.1f  加速 %.2fx\n", "HPA*", qMs,
+                (double)expanded / QUERIES, (double)refine / QUERIES, bs.totalMs / qMs);
+            printf("  路径总长 %lld vs 最优 %lld（+%.2f%%），%d 条更长，可达性不一致 %d\n", lenSum, refSum,
+                refSum ? 100.0 * (lenSum - refSum) / refSum : 0.0, longer, missing);
+
+            // 单格修改：只重建所在簇与四邻簇
+            const int EDITS = 100;
+            t0 = nowMs();
+            for (int i = 0; i < EDITS; i++) {
+                int x = (int)(rng() % m.rows), y = (int)(rng() % m.cols);
+                hpa.setCell(x, y, hpa.grid().at(x, y) == WALL ? 1 : 0);
+            }
+            double editMs = (nowMs() - t0) / EDITS;
+            printf("  单格修改重建 %.3f ms / 次（整图建立的 %.2f%%）\n", editMs, 100.0 * editMs / buildMs);
+        }
+    }
+}
+
+// 逐格开关后重规划：D* Lite 增量修复 vs 每次重新 setMaze + A*
+static void benchDStar(const vector<int>& sizes) {
+    const int EDITS = 100;
+    printf("== dstar: %d 次单格开关，每次之后重新求路径 ==\n", EDITS);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            DStarLite planner;
+            planner.setMaze(m);
+            vector<pair<int, int>> path;
+            DStarStats st;
+            planner.plan(path, &st);
+            MazeSolverCore solver;
+            double t0 = nowMs();
+            solver.setMaze(m);
+            SolveResult first = solver.solveAStar();
+            double aMs = nowMs() - t0;
+            printf("  首次规划  D* Lite %9.2f ms  扩展 %9d  |  setMaze+A* %9.2f ms  扩展 %9d\n", st.ms, st.expanded, aMs,
+                first.visitedCount);
+
+            // 一半改动落在当前路径上（迫使绕行），一半随机
+            mt19937 rng(99u);
+            double dMs = 0, fullMs = 0;
+            long long dExp = 0, fullExp = 0, dUpd = 0;
+            int diff = 0;
+            for (int e = 0; e < EDITS; e++) {
+                int x, y;
+                if ((e & 1) == 0 && path.size() > 2) {
+                    auto c = path[1 + rng() % (path.size() - 2)];
+                    x = c.first; y = c.second;
+                }else {
+                    do { x = (int)(rng() % m.rows); y = (int)(rng() % m.cols); } while (x == m.startX && y == m.startY);
+                }
+                m.map.at(x, y) = m.map.at(x, y) == WALL ? 1 : 0;
+                t0 = nowMs();
+                planner.setCell(x, y, m.map.at(x, y));
+                bool ok = planner.plan(path, &st);
+                dMs += nowMs() - t0;
+                dExp += st.expanded;
+                dUpd += st.updated;
+                t0 = nowMs();
+                solver.setMaze(m);
+                SolveResult r = solver.solveAStar();
+                fullMs += nowMs() - t0;
+                fullExp += r.visitedCount;
+                if (ok != r.found || (ok && (int)path.size() != r.pathLen)) diff++;
+                // 路径被截断时恢复该格，保持后续改动有路径可扰动
+                if (!ok) {
+                    m.map.at(x, y) = 1;
+                    planner.setCell(x, y, 1);
+                    planner.plan(path, &st);
+                }
+            }
+            printf("  每次修复  D* Lite %9.3f ms  扩展 %9.1f  更新 %9.1f\n", dMs / EDITS, (double)dExp / EDITS, (double)dUpd / EDITS);
+            printf("  每次重解  setMaze+A* %6.3f ms  扩展 %9.1f  加速 %.2fx  路径长度不一致 %d\n", fullMs / EDITS,
+                (double)fullExp / EDITS, fullMs / dMs, diff);
+            printf("  D* Lite 常驻状态 %.1f MB\n", planner.scratchBytes() / 1048576.0);
+        }
+    }
+}
+
+// 大尺寸迷宫生成：各算法耗时、网格内存、死胡同比例；Eller 另测逐行写盘
+static void benchGen(const vector<int>& sizes) {
+    printf("== gen: 各生成算法（固定种子） ==\n");
+    const uint64_t SEED = 20240601ull;
+    for (int n : sizes) {
+        printf("%dx%d  网格 %.1f MB\n", n, n, (double)(n + 2) * (n + 2) / 1048576.0);
+        for (int a = GEN_BACKTRACK; a <= GEN_TILED; a++) {
+            MazeData m;
+            double t0 = nowMs();
+            generateMazeData(m, n, n, SEED, (MazeGenAlgo)a);
+            double ms = nowMs() - t0;
+            long long roads = 0, deadEnds = 0;
+            for (int i = 1; i < m.rows - 1; i++) {
+                for (int j = 1; j < m.cols - 1; j++) {
+                    if (m.map.at(i, j) == WALL) continue;
+                    roads++;
+                    int deg = (m.map.at(i + 1, j) != WALL) + (m.map.at(i - 1, j) != WALL) +
+                        (m.map.at(i, j + 1) != WALL) + (m.map.at(i, j - 1) != WALL);
+                    deadEnds += deg == 1;
+                }
+            }
+            printf("  %-10s %10.1f ms  %8.1f 百万格/s  死胡同 %5.1f%%  峰值 RSS %8.1f MB  哈希 %016llx\n",
+                genAlgoName((MazeGenAlgo)a), ms, (double)n * n / ms / 1000.0, 100.0 * deadEnds / roads, peakRssMb(),
+                (unsigned long long)hashMazeData(m));
+        }
+        // 分块生成：不同线程数结果必须一致
+        int hw = (int)thread::hardware_concurrency();
+        uint64_t ref = 0;
+        for (int t = 1; t <= max(hw, 4); t *= 2) {
+            MazeData m;
+            double t0 = nowMs();
+            generateTiledMaze(m, n, n, SEED, t);
+            double ms = nowMs() - t0;
+            uint64_t h = hashMazeData(m);
+            if (t == 1) ref = h;
+            printf("  tiled %2d 线程 %8.1f ms  %8.1f 百万格/s  哈希 %016llx %s\n", t, ms, (double)n * n / ms / 1000.0,
+                (unsigned long long)h, h == ref ? "" : "（与 1 线程不一致！）");
+        }
+        const char* fname = "maze_bench_eller.txt";
+        uint64_t seed = SEED;
+        string err;
+        double t0 = nowMs();
+        bool ok = streamEllerMaze(fname, n, n, seed, err);
+        double ms = nowMs() - t0;
+        if (ok) printf("  %-10s %10.1f ms  %8.1f 百万格/s  写出 %.1f MB（只占 O(列数) 内存）\n", "eller 写盘", ms,
+            (double)n * n / ms / 1000.0, (double)n * (2.0 * n) / 1048576.0);
+        else printf("  eller 写盘失败: %s\n", err.c_str());
+        remove(fname);
+    }
+}
+
+// 全路径枚举：剪枝（双连通区域 + 分支可达性）与不剪枝的显式栈 DFS 对比
+static void benchAllPaths(const vector<int>& sizes) {
+    const long long LIMIT = 1000;
+    const double BUDGET = 2000;
+    printf("== allpaths: 最多 %lld 条，时间上限 %.0f ms ==\n", LIMIT, BUDGET);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) generateMazeData(m, n, n, 7ull);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            printf("%dx%d %s\n", n, n, kind == 0 ? "迷宫" : "房间地图(32x32, 10%障碍)");
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            for (int prune = 1; prune >= 0; prune--) {
+                AllPathsOptions opt;
+                opt.limit = LIMIT;
+                opt.timeBudgetMs = BUDGET;
+                opt.prune = prune != 0;
+                double t0 = nowMs(), first = -1;
+                opt.onPath = [&](const vector<pair<int, int>>&) {
+                    if (first < 0) first = nowMs() - t0;
+                    return true;
+                };
+                AllPathsStats st = solver.enumeratePaths(opt);
+                printf("  %-6s %9.1f ms  路径 %6lld  首条 %9.2f ms  进入格子 %12lld  每条 %10.1f  区域 %9d 格  检查 %8lld  %s\n",
+                    prune ? "剪枝" : "不剪枝", st.ms, st.paths, first, st.steps, st.paths ? (double)st.steps / st.paths : 0.0,
+                    st.regionCells, st.reachChecks, st.complete ? "完成" : st.timedOut ? "超时" : "达到上限");
+            }
+        }
+    }
+}
+
+// 编织迷宫：完美迷宫上随机打通 percent% 的内部隔墙，制造环路
+static void makeBraidMaze(MazeData& m, int rows, int cols, int percent, uint64_t seed) {
+    generateMazeData(m, rows, cols, seed);
+    mt19937 rng((unsigned)seed);
+    for (int i = 1; i + 1 < rows; i++)
+        for (int j = 1; j + 1 < cols; j++) {
+            if (m.map.at(i, j) != WALL) continue;
+            bool horiz = m.map.at(i, j - 1) != WALL && m.map.at(i, j + 1) != WALL;
+            bool vert = m.map.at(i - 1, j) != WALL && m.map.at(i + 1, j) != WALL;
+            if (horiz != vert && (int)(rng() % 100) < percent) m.map.at(i, j) = ROAD;
+        }
+}
+
+// K 条最短简单路径：Yen 算法，偏离搜索复用终点距离场
+static void benchKPaths(const vector<int>& sizes) {
+    const int K = 100;
+    printf("== kpaths: K = %d ==\n", K);
+    for (int n : sizes) {
+        for (int kind = 0; kind < 2; kind++) {
+            MazeData m;
+            if (kind == 0) makeBraidMaze(m, n, n, 5, 7ull);
+            else makeRoomsMap(m, n, 32, 10, 12345u);
+            MazeSolverCore solver;
+            solver.setMaze(m);
+            vector<vector<pair<int, int>>> paths;
+            KPathsStats st = solver.solveKShortest(K, paths);
+            printf("%dx%d %-26s %9.1f ms  路径 %4d  长度 %d..%d  偏离点 %9lld  下界跳过 %9lld  树下降 %8lld  A* %6lld\n",
+                n, n, kind == 0 ? "编织迷宫(5%打通)" : "房间地图(32x32, 10%障碍)", st.ms, st.paths,
+                paths.empty() ? 0 : (int)paths.front().size(), paths.empty() ? 0 : (int)paths.back().size(),
+                st.spurNodes, st.bounded, st.treeHits, st.searches);
+        }
+    }
+}
+
+// 简单路径计数：前沿动态规划，按前沿宽度给出状态数与耗时。
+// 无障碍的空地是状态最多的情形（16x16 约 300 万个状态），超过 14 宽时只测编织迷宫
+static void benchCount(const vector<int>& widths) {
+    printf("== count: 起点到终点的简单路径数（插头 DP）==\n");
+    for (int w : widths) {
+        for (int kind = 0; kind < 2; kind++) {
+            if (kind == 0 && w > 14) continue;
+            MazeData m;
+            if (kind == 0) {
+                m.rows = m.cols = w;
+                m.map.assign(w, w, ROAD);
+                m.endX = m.endY = w - 1;
+            }else makeBraidMaze(m, 2001, w, 30, 7ull);
+            PathCountStats st = countSimplePaths(m);
+            printf("%5dx%-3d %-16s %10.1f ms  状态峰值 %9zu  字数 %3d  路径数 %s\n", m.rows, m.cols,
+                kind == 0 ? "空地" : "编织迷宫(30%打通)", st.ms, st.peakStates, st.limbs,
+                st.ok ? st.count.c_str() : "（状态数超出上限）");
+        }
+    }
+}
+
+// 旧加载方式：ifstream 逐字符 >>
+static bool legacyLoad(const string& fname, MazeData& m) {
+    ifstream file(fname);
+    if (!(file >> m.rows >> m.cols)) return false;
+    m.map.assign(m.rows, m.cols, WALL);
+    char ch;
+    for (int i = 0; i < m.rows; i++)
+        for (int j = 0; j < m.cols; j++) {
+            if (!(file >> ch)) return false;
+            m.map.at(i, j) = ch == '.' ? ROAD : WALL;
+        }
+    return (bool)(file >> m.startX >> m.startY >> m.endX >> m.endY);
+}
+
+// maze.txt 加载：先用 Eller 逐行写出 n x n 的文件，再分别加载
+static void benchLoad(const vector<int>& sizes) {
+    printf("== load: ifstream 逐字符 vs 内存映射扫描 ==\n");
+    const string fname = "maze_bench_load.txt";
+    for (int n : sizes) {
+        uint64_t seed = 1;
+        string err;
+        if (!streamEllerMaze(fname, n, n, seed, err)) { printf("%s\n", err.c_str()); return; }
+        MazeData a, b;
+        double t0 = nowMs();
+        legacyLoad(fname, a);
+        double ms1 = nowMs() - t0;
+        t0 = nowMs();
+        bool ok = loadMazeFile(fname, b, err);
+        double ms2 = nowMs() - t0;
+        double mcells = (double)n * n / 1e6;
+        printf("%dx%d (%.0f M 格)\n", n, n, mcells);
+        printf("  %-10s %10.1f ms  %8.1f M格/s\n", "ifstream", ms1, mcells / ms1 * 1000.0);
+        printf("  %-10s %10.1f ms  %8.1f M格/s  加速 %.1fx  %s\n", "mmap", ms2, mcells / ms2 * 1000.0, ms1 / ms2,
+            !ok ? err.c_str() : hashMazeData(a) == hashMazeData(b) ? "结果一致" : "结果不一致");
+    }
+    remove(fname.c_str());
+}
+
+// 二进制地图：文件大小、打开（含校验）与展开耗时，以及位并行 BFS 展开后求解与直接在映射位图上求解的对比
+static void benchBinary(const vector<int>& sizes) {
+    printf("== binary: maze.txt vs .mazb ==\n");
+    const string txt = "maze_bench_bin.txt", bin = "maze_bench_bin.mazb";
+    for (int n : sizes) {
+        MazeData m;
+        generateMazeData(m, n, n, 1ull);
+        string err;
+        if (!saveMazeFile(txt, m, err) || !saveMazeBinary(bin, m, err)) { printf("%s\n", err.c_str()); return; }
+        MappedFile ft, fb;
+        ft.open(txt, err);
+        fb.open(bin, err);
+        printf("%dx%d  文本 %.1f MB  二进制 %.1f MB（%.2f bit/格）\n", n, n, ft.size() / 1048576.0, fb.size() / 1048576.0,
+            fb.size() * 8.0 / ((double)n * n));
+        MazeData a, b;
+        double t0 = nowMs();
+        loadMazeFile(txt, a, err);
+        double msText = nowMs() - t0;
+        t0 = nowMs();
+        MazeBinaryFile f;
+        bool ok = f.open(bin, err);
+        double msOpen = nowMs() - t0;
+        t0 = nowMs();
+        if (ok) f.unpack(b);
+        double msUnpack = nowMs() - t0;
+        printf("  加载文本 %8.1f ms   打开二进制（校验）%7.1f ms   展开 %7.1f ms  %s\n", msText, msOpen, msUnpack,
+            !ok ? err.c_str() : hashMazeData(a) == hashMazeData(b) ? "结果一致" : "结果不一致");
+        if (!ok) continue;
+        // 逐格算法需要展开后的字节网格；位并行 BFS 可在映射位图上直接运行，不需要展开
+        MazeSolverCore s1, s2;
+        t0 = nowMs();
+        s1.setMaze(b);
+        SolveResult r1 = s1.solveBFS(nullptr, BFS_BITSET);
+        double ms1 = nowMs() - t0;
+        t0 = nowMs();
+        MazeData shape;
+        f.describe(shape);
+        s2.setMazeBits(shape, f.bits());
+        SolveResult r2 = s2.solveBFS(nullptr, BFS_BITSET);
+        double ms2 = nowMs() - t0;
+        printf("  bitbfs: 字节网格 setMaze + 求解 %7.1f ms（另需展开 %.1f ms）   映射位图直接求解 %7.1f ms   pathLen %d / %d\n",
+            ms1, msUnpack, ms2, r1.pathLen, r2.pathLen);
+    }
+    remove(txt.c_str());
+    remove(bin.c_str());
+}
+
+// 网格布局对比
+static void benchGrid(const vector<int>& sizes) {
+    printf("== grid: vector<vector<int>> vs MazeGrid (全图 BFS) ==\n");
+    for (int n : sizes) {
+        MazeData m;
+        double t0 = nowMs();
+        generateMazeData(m, n, n);
+        printf("%dx%d (生成 %.0f ms)\n", n, n, nowMs() - t0);
+        long long cells = (long long)n * n;
+        CacheMissCounter pc;
+        int d1 = 0, d2 = 0;
+
+        pc.start(); t0 = nowMs();
+        long long e1 = legacyBFS(m, d1);
+        double ms1 = nowMs() - t0; long long miss1 = pc.stop();
+        printRow("vector<vector<int>>", ms1, e1, miss1, cells * (long long)sizeof(int));
+
+        pc.start(); t0 = nowMs();
+        long long e2 = flatBFS(m, d2);
+        double ms2 = nowMs() - t0; long long miss2 = pc.stop();
+        printRow("MazeGrid uint8", ms2, e2, miss2, m.map.size());
+
+        printf("  dist %d / %d  加速 %.2fx\n", d1, d2, ms1 / ms2);
+    }
+}
+
+// 核心求解器耗时（同一求解器连续运行，搜索缓冲区在多次搜索间复用）
+static void benchSolve(const vector<int>& sizes) {
+    printf("== solve: MazeSolverCore DFS / BFS / A* ==\n");
+    for (int n : sizes) {
+        MazeData m;
+        generateMazeData(m, n, n);
+        MazeSolverCore solver;
+        solver.setMaze(m);
+        printf("%dx%d\n", n, n);
+        const char* names[3] = { "DFS", "BFS", "A*" };
+        for (int k = 0; k < 3; k++) {
+            double t0 = nowMs();
+            SolveResult r = (k == 0) ? solver.solveDFS() : (k == 1) ? solver.solveBFS() : solver.solveAStar();
+            double ms = nowMs() - t0;
+            printf("  %-4s %10.2f ms  pathLen %9d  visited %10d  %8.1f Mnode/s\n",
+                names[k], ms, r.pathLen, r.visitedCount, r.visitedCount / ms / 1000.0);
+        }
+        printf("  搜索附加内存 %.1f MB（%.2f B/格）\n", solver.scratchBytes() / 1048576.0,
+            (double)solver.scratchBytes() / ((double)n * n));
+    }
+}
+
+static vector<int> parseSizes(int argc, char** argv, int from, vector<int> def) {
+    vector<int> v;
+    for (int i = from; i < argc; i++) v.push_back(atoi(argv[i]));
+    return v.empty() ? def : v;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cout << "用法: maze_bench grid [size...]\n"
+             << "      maze_bench solve [size...]\n"
+             << "      maze_bench astar [size...]\n"
+             << "      maze_bench bidir [size...]\n"
+             << "      maze_bench jps [size...]\n"
+             << "      maze_bench bitbfs [size...]\n"
+             << "      maze_bench pbfs [size...]\n"
+             << "      maze_bench batch [size...]\n"
+             << "      maze_bench pool [rounds...]\n"
+             << "      maze_bench reset [size...]\n"
+             << "      maze_bench field [size...]\n"
+             << "      maze_bench corridor [size...]\n"
+             << "      maze_bench deadend [size...]\n"
+             << "      maze_bench hpa [size...]\n"
+             << "      maze_bench dstar [size...]\n"
+             << "      maze_bench gen [size...]\n"
+             << "      maze_bench allpaths [size...]\n"
+             << "      maze_bench kpaths [size...]\n"
+             << "      maze_bench count [width...]\n"
+             << "      maze_bench load [size...]\n"
+             << "      maze_bench binary [size...]\n";
+        return 1;
+    }
+    string cmd = argv[1];
+    if (cmd == "grid") benchGrid(parseSizes(argc, argv, 2, { 4097, 8193 }));
+    else if (cmd == "solve") benchSolve(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "astar") benchAStar(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "bidir") benchBidir(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "jps") benchJps(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "bitbfs") benchBitBfs(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "pbfs") benchParallelBfs(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "batch") benchBatch(parseSizes(argc, argv, 2, { 257, 513 }));
+    else if (cmd == "pool") benchPool(parseSizes(argc, argv, 2, { 1000, 10000 }));
+    else if (cmd == "reset") benchReset(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "field") benchField(parseSizes(argc, argv, 2, { 513, 1025 }));
+    else if (cmd == "corridor") benchCorridor(parseSizes(argc, argv, 2, { 2001 }));
+    else if (cmd == "deadend") benchDeadEnd(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "hpa") benchHpa(parseSizes(argc, argv, 2, { 1025, 2049 }));
+    else if (cmd == "dstar") benchDStar(parseSizes(argc, argv, 2, { 513, 1025 }));
+    else if (cmd == "allpaths") benchAllPaths(parseSizes(argc, argv, 2, { 65, 257, 1025 }));
+    else if (cmd == "kpaths") benchKPaths(parseSizes(argc, argv, 2, { 1025, 4097 }));
+    else if (cmd == "count") benchCount(parseSizes(argc, argv, 2, { 12, 14, 16, 20 }));
+    else if (cmd == "load") benchLoad(parseSizes(argc, argv, 2, { 2001, 10001 }));
+    else if (cmd == "binary") benchBinary(parseSizes(argc, argv, 2, { 2001, 10001 }));
+    else if (cmd == "gen") benchGen(parseSizes(argc, argv, 2, { 1001, 4001, 10001 }));
+    else { cerr << "未知子命令: " << cmd << endl; return 1; }
+    return 0;
+}
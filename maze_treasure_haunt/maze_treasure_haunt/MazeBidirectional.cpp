@@ -0,0 +1,130 @@
+// 双向 BFS / 双向 A*：正向从起点、反向从终点同时扩展
+#include "MazeCore.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+// 拼接相遇路径：meetF 在正向树上，meetB 在反向树上（二者相邻或相同）
+void MazeSolverCore::markBiPath(int meetF, int meetB) {
+    pathIds.clear();
+    for (int cur = meetF; ; cur -= off[parentDir.get(cur)]) {
+        pathIds.push_back(cur);
+        if (cur == startId) break;
+    }
+    reverse(pathIds.begin(), pathIds.end());
+    int cur = meetB;
+    if (meetB == meetF) cur = (cur == endId) ? -1 : cur - off[parentDirRev.get(cur)];
+    while (cur >= 0) {
+        pathIds.push_back(cur);
+        if (cur == endId) break;
+        cur -= off[parentDirRev.get(cur)];
+    }
+    emitPath();
+}
+
+// 双向 BFS：每次把较小的一侧整层扩展一步。
+// 按层交替时，同一层内发现的相遇点总长都相等，因此第一个相遇点即最短路径
+SolveResult MazeSolverCore::solveBiBFS(SearchObserver* o) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!endsOpen()) return res;
+    if (startId == endId) { markPath(startId); return res; }
+    frontier.push_back(startId);
+    workMap.set(startId, VISITED);
+    frontierRev.push_back(endId);
+    workMap.set(endId, VISITED_REV);
+    int meetF = -1, meetB = -1;
+    while (!frontier.empty() && !frontierRev.empty() && meetF < 0) {
+        bool forward = frontier.size() <= frontierRev.size();
+        vector<int>& cur = forward ? frontier : frontierRev;
+        ParentDirs& pd = forward ? parentDir : parentDirRev;
+        uint8_t mine = (uint8_t)(forward ? VISITED : VISITED_REV);
+        uint8_t other = (uint8_t)(forward ? VISITED_REV : VISITED);
+        frontierNext.clear();
+        for (int u : cur) {
+            ++res.visitedCount;
+            if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(maze.map.toX(u), maze.map.toY(u)); }
+            for (int i = 0; i < 4; i++) {
+                int nid = u + off[i];
+                uint8_t c = workMap[nid];
+                if (c == other) {           // 两侧前沿相遇
+                    meetF = forward ? u : nid;
+                    meetB = forward ? nid : u;
+                    break;
+                }
+                if (c == ROAD) {
+                    workMap.set(nid, mine);
+                    pd.set(nid, i);
+                    frontierNext.push_back(nid);
+                }
+            }
+            if (meetF >= 0) break;
+            if (obs) obs->onVisited(maze.map.toX(u), maze.map.toY(u));
+        }
+        cur.swap(frontierNext);
+    }
+    if (meetF >= 0) markBiPath(meetF, meetB);
+    return res;
+}
+
+// 双向 A*（NBA*，Pijls & Post）：两侧各用一致的曼哈顿启发式，共享关闭集，
+// L 为目前最短的相遇路径长度。出队节点若 g + h >= L 或 g + F对侧 - h对侧 >= L
+// 则不可能在更短路径上，直接剔除不扩展；任一侧开放表为空时结束
+SolveResult MazeSolverCore::solveBiAStar(SearchObserver* o) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!endsOpen()) return res;
+    const int INF = INT_MAX;
+    if (minG.size() != maze.map.size()) minG.resize(maze.map.size(), INF);
+    if (minGRev.size() != maze.map.size()) minGRev.resize(maze.map.size(), INF);
+    openHeap.clear();
+    openHeapRev.clear();
+    auto hRev = [&](int id) { return abs(maze.map.toX(id) - maze.startX) + abs(maze.map.toY(id) - maze.startY); };
+    openHeap.push({ calcH(startId), 0, startId });
+    minG.set(startId, 0);
+    openHeapRev.push({ hRev(endId), 0, endId });
+    minGRev.set(endId, 0);
+    int fTop[2] = { calcH(startId), hRev(endId) };   // 两侧开放表当前最小 f
+    int L = (startId == endId) ? 0 : INF;
+    int meet = (startId == endId) ? startId : -1;
+    while (!openHeap.empty() && !openHeapRev.empty()) {
+        bool forward = openHeap.size() <= openHeapRev.size();
+        int side = forward ? 0 : 1;
+        IndexedHeap& open = forward ? openHeap : openHeapRev;
+        EpochTable& g = forward ? minG : minGRev;
+        EpochTable& gOther = forward ? minGRev : minG;
+        ParentDirs& pd = forward ? parentDir : parentDirRev;
+        OpenEntry cur = open.pop();
+        if (workMap[cur.id] == VISITED || workMap[cur.id] == VISITED_REV) continue;
+        workMap.set(cur.id, (uint8_t)(forward ? VISITED : VISITED_REV));   // 加入共享关闭集
+        int hSelf = forward ? calcH(cur.id) : hRev(cur.id);
+        int hOther = forward ? hRev(cur.id) : calcH(cur.id);
+        bool prune = L != INF && (cur.g + hSelf >= L || cur.g + fTop[1 - side] - hOther >= L);
+        if (!prune) {
+            ++res.visitedCount;
+            int cx = maze.map.toX(cur.id); int cy = maze.map.toY(cur.id);
+            if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(cx, cy); }
+            if (obs) obs->onVisited(cx, cy);
+            for (int i = 0; i < 4; i++) {
+                int nid = cur.id + off[i];
+                uint8_t c = workMap[nid];
+                if (c == WALL || c == VISITED || c == VISITED_REV) continue;
+                int newG = cur.g + 1;
+                if (newG >= g[nid]) continue;
+                OpenEntry e = { newG + (forward ? calcH(nid) : hRev(nid)), newG, nid };
+                if (open.contains(nid)) { open.decrease(e); res.decreaseKeys++; }
+                else open.push(e);
+                g.set(nid, newG);
+                pd.set(nid, i);
+                if (gOther[nid] != INF && newG + gOther[nid] < L) {
+                    L = newG + gOther[nid];
+                    meet = nid;
+                }
+            }
+        }
+        if (!open.empty()) fTop[side] = open.top().f;
+    }
+    if (meet >= 0) markBiPath(meet, meet);
+    return res;
+}
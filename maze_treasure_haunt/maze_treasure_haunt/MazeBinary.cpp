@@ -0,0 +1,146 @@
+// 二进制地图：位图按 BitGrid 布局存放，读取时内存映射并直接引用
+#include "MazeBinary.h"
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+static const char MAGIC[4] = { 'M', 'A', 'Z', 'B' };
+
+// 头部字段按小端读写；位图直接按本机 64 位字读写，只支持小端主机（x86 / ARM）
+static void put16(char* p, uint32_t v) { p[0] = (char)v; p[1] = (char)(v >> 8); }
+static void put32(char* p, uint32_t v) { for (int i = 0; i < 4; i++) p[i] = (char)(v >> (8 * i)); }
+static void put64(char* p, uint64_t v) { for (int i = 0; i < 8; i++) p[i] = (char)(v >> (8 * i)); }
+static uint32_t get16(const char* p) { return (uint32_t)(uint8_t)p[0] | ((uint32_t)(uint8_t)p[1] << 8); }
+static uint32_t get32(const char* p) { uint32_t v = 0; for (int i = 3; i >= 0; i--) v = (v << 8) | (uint8_t)p[i]; return v; }
+static uint64_t get64(const char* p) { uint64_t v = 0; for (int i = 7; i >= 0; i--) v = (v << 8) | (uint8_t)p[i]; return v; }
+
+// FNV-1a：头部逐字节，位图逐 64 位字
+static uint64_t binChecksum(const char* head, const uint64_t* words, size_t n) {
+    uint64_t h = 1469598103934665603ull;
+    for (size_t i = 0; i < 56; i++) h = (h ^ (uint8_t)head[i]) * 1099511628211ull;
+    for (size_t i = 0; i < n; i++) h = (h ^ words[i]) * 1099511628211ull;
+    return h;
+}
+
+bool isMazeBinary(const char* data, size_t n) {
+    return n >= 4 && memcmp(data, MAGIC, 4) == 0;
+}
+
+bool saveMazeBinary(const string& fname, const MazeData& maze, string& err) {
+    if (maze.empty()) { err = "地图为空"; return false; }
+    BitGrid bits;
+    bits.assign(maze.rows, maze.cols);
+    for (int i = 0; i < maze.rows; i++) {
+        const uint8_t* src = maze.map.data() + maze.map.id(i, 0);
+        uint64_t* dst = bits.row(i);
+        for (int j = 0; j < maze.cols; j++)
+            if (src[j] != WALL) dst[j >> 6] |= (uint64_t)1 << (j & 63);
+    }
+    size_t words = (size_t)(maze.rows + 2) * bits.words();
+    char head[MAZE_BIN_HEADER_BYTES] = {};
+    memcpy(head, MAGIC, 4);
+    put16(head + 4, MAZE_BIN_VERSION);
+    put16(head + 6, (uint32_t)MAZE_BIN_HEADER_BYTES);
+    put32(head + 8, (uint32_t)maze.rows);
+    put32(head + 12, (uint32_t)maze.cols);
+    put32(head + 16, (uint32_t)maze.startX);
+    put32(head + 20, (uint32_t)maze.startY);
+    put32(head + 24, (uint32_t)maze.endX);
+    put32(head + 28, (uint32_t)maze.endY);
+    put64(head + 32, maze.seed);
+    put32(head + 40, (uint32_t)bits.words());
+    put64(head + 48, (uint64_t)words * 8);
+    put64(head + 56, binChecksum(head, bits.row(-1), words));
+    ofstream out(fname, ios::binary);
+    if (!out.is_open()) { err = "无法写入文件: " + fname; return false; }
+    out.write(head, sizeof(head));
+    out.write((const char*)bits.row(-1), (streamsize)(words * 8));
+    if (!out) { err = "写入失败: " + fname; return false; }
+    return true;
+}
+
+bool MazeBinaryFile::open(const string& fname, string& err) {
+    if (!file.open(fname, err)) return false;
+    if (!openMapped(file.data(), file.size(), err)) { err = fname + ": " + err; return false; }
+    return true;
+}
+
+bool MazeBinaryFile::openMapped(const char* data, size_t n, string& err) {
+    if (n < MAZE_BIN_HEADER_BYTES || !isMazeBinary(data, n)) { err = "不是二进制地图文件"; return false; }
+    MazeBinHeader h;
+    h.version = get16(data + 4);
+    if (h.version != MAZE_BIN_VERSION) { err = "不支持的版本 " + to_string(h.version); return false; }
+    if (get16(data + 6) != MAZE_BIN_HEADER_BYTES) { err = "文件头长度无效"; return false; }
+    h.rows = get32(data + 8);
+    h.cols = get32(data + 12);
+    h.startX = get32(data + 16);
+    h.startY = get32(data + 20);
+    h.endX = get32(data + 24);
+    h.endY = get32(data + 28);
+    h.seed = get64(data + 32);
+    h.rowWords = get32(data + 40);
+    if (get32(data + 44) != 0) { err = "文件头保留字段不为 0"; return false; }
+    uint64_t bytes = get64(data + 48);
+    h.checksum = get64(data + 56);
+    // 先扩到 64 位再加哨兵，避免构造的行列数在 32 位上回绕
+    uint64_t rows = h.rows, cols = h.cols;
+    if (rows == 0 || cols == 0 || rows > INT_MAX || cols > INT_MAX || (rows + 2) * (cols + 2) > INT_MAX) {
+        err = "地图尺寸无效（" + to_string(h.rows) + "x" + to_string(h.cols) + "）";
+        return false;
+    }
+    uint64_t nw = (rows + 2) * h.rowWords;
+    if (h.rowWords != (cols + 63) / 64 || bytes != nw * 8) { err = "位图尺寸与行列数不符"; return false; }
+    if (n - MAZE_BIN_HEADER_BYTES < bytes) { err = "文件不完整"; return false; }
+    if (h.startX >= h.rows || h.startY >= h.cols || h.endX >= h.rows || h.endY >= h.cols) { err = "起点或终点越界"; return false; }
+    // 映射基址按页对齐、头长 64，位图按 8 字节对齐
+    const uint64_t* words = (const uint64_t*)(data + MAZE_BIN_HEADER_BYTES);
+    if (binChecksum(data, words, (size_t)nw) != h.checksum) { err = "校验和不符"; return false; }
+    // 位并行搜索依赖哨兵行与行尾填充位为 0
+    uint64_t pad = (cols % 64) ? ~0ull << (cols % 64) : 0;
+    for (uint64_t w = 0; w < h.rowWords; w++)
+        if (words[w] || words[nw - h.rowWords + w]) { err = "哨兵行不为 0"; return false; }
+    for (uint64_t r = 0; r < rows; r++)
+        if (words[(r + 2) * h.rowWords - 1] & pad) { err = "第 " + to_string(r) + " 行行尾填充位不为 0"; return false; }
+    auto passable = [&](uint32_t x, uint32_t y) { return (words[(x + 1ull) * h.rowWords + (y >> 6)] >> (y & 63)) & 1; };
+    if (!passable(h.startX, h.startY)) { err = "起点 (" + to_string(h.startX) + ", " + to_string(h.startY) + ") 位于墙上"; return false; }
+    if (!passable(h.endX, h.endY)) { err = "终点 (" + to_string(h.endX) + ", " + to_string(h.endY) + ") 位于墙上"; return false; }
+    hdr = h;
+    view.attach((int)h.rows, (int)h.cols, words);
+    return true;
+}
+
+// 位图的一个字节展开为 8 个格子（ROAD = 1，WALL = 0），按小端拼成一个 64 位字
+struct ByteSpread {
+    uint64_t v[256];
+    ByteSpread() {
+        for (int b = 0; b < 256; b++) {
+            v[b] = 0;
+            for (int k = 0; k < 8; k++) if ((b >> k) & 1) v[b] |= (uint64_t)ROAD << (8 * k);
+        }
+    }
+};
+
+void MazeBinaryFile::describe(MazeData& maze) const {
+    maze.rows = (int)hdr.rows;
+    maze.cols = (int)hdr.cols;
+    maze.startX = (int)hdr.startX; maze.startY = (int)hdr.startY;
+    maze.endX = (int)hdr.endX; maze.endY = (int)hdr.endY;
+    maze.seed = hdr.seed;
+    maze.map = MazeGrid();
+}
+
+void MazeBinaryFile::unpack(MazeData& maze) const {
+    describe(maze);
+    maze.map.assign(maze.rows, maze.cols, WALL);
+    static const ByteSpread spread;
+    int full = maze.cols / 8;
+    for (int i = 0; i < maze.rows; i++) {
+        const uint8_t* src = (const uint8_t*)view.row(i);
+        uint8_t* dst = maze.map.data() + maze.map.id(i, 0);
+        for (int k = 0; k < full; k++) memcpy(dst + 8 * k, &spread.v[src[k]], 8);
+        for (int j = full * 8; j < maze.cols; j++) dst[j] = (uint8_t)((src[j >> 3] >> (j & 7)) & 1);
+    }
+}
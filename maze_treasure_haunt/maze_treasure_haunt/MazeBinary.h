@@ -0,0 +1,55 @@
+﻿#pragma once
+// 二进制地图格式（.mazb，小端）：
+//   0   "MAZB"           4 字节魔数
+//   4   版本 u16 = 1，头长 u16 = 64
+//   8   rows, cols, startX, startY, endX, endY   各 u32
+//   32  seed u64
+//   40  每行字数 u32 = (cols + 63) / 64，保留 u32 = 0
+//   48  位图字节数 u64 = (rows + 2) * 每行字数 * 8
+//   56  校验和 u64：头部前 56 字节与位图的 FNV-1a（位图按 64 位字）
+//   64  位图：与 BitGrid 布局相同，每行按 64 位字对齐，首尾各一行全 0 哨兵，1 为可走
+// 位图与 BitGrid 布局相同：位并行 BFS 与连通区域可直接在映射内容上运行，无需解包；
+// 其余算法按格子读字节网格，需先 unpack
+#include "MazeCore.h"
+#include "MazeMappedFile.h"
+#include <cstdint>
+#include <string>
+
+const uint32_t MAZE_BIN_VERSION = 1;
+const size_t MAZE_BIN_HEADER_BYTES = 64;
+
+struct MazeBinHeader {
+    uint32_t version = 0;
+    uint32_t rows = 0, cols = 0;
+    uint32_t startX = 0, startY = 0, endX = 0, endY = 0;
+    uint64_t seed = 0;
+    uint32_t rowWords = 0;
+    uint64_t checksum = 0;
+};
+
+// 内容以 "MAZB" 开头即视为二进制地图
+bool isMazeBinary(const char* data, size_t n);
+
+// 写出二进制地图
+bool saveMazeBinary(const std::string& fname, const MazeData& maze, std::string& err);
+
+// 内存映射打开的二进制地图：打开时校验头部、尺寸、哨兵与行尾填充位、校验和
+class MazeBinaryFile {
+public:
+    bool open(const std::string& fname, std::string& err);
+    // 已映射的内容上校验并建立视图（loadMazeFile 自动识别格式时使用）
+    bool openMapped(const char* data, size_t n, std::string& err);
+
+    const MazeBinHeader& header() const { return hdr; }
+    // 引用映射内容的只读位图，文件对象存活期间有效
+    const BitGrid& bits() const { return view; }
+    // 只填尺寸、起终点与种子，map 置空（配合 MazeSolverCore::setMazeBits，不展开）
+    void describe(MazeData& maze) const;
+    // 展开为字节网格（逐格算法需要）
+    void unpack(MazeData& maze) const;
+
+private:
+    MappedFile file;
+    MazeBinHeader hdr;
+    BitGrid view;
+};
@@ -0,0 +1,160 @@
+// 位并行 BFS：每行为若干 64 位字，一层扩展 = 前沿左右移位 | 上下行前沿，再与可走且未访问的位相与。
+// 只处理前沿所在的字及其上下左右相邻字，每层代价与前沿规模成正比
+#include "MazeCore.h"
+#include <algorithm>
+
+using namespace std;
+
+void MazeSolverCore::runBitBFS() {
+    const BitGrid& pass = passBits;        // 可能引用映射的二进制地图，只读
+    int rows = maze.rows, nw = pass.words();
+    if (!pass.test(maze.startX, maze.startY) || !pass.test(maze.endX, maze.endY)) return;   // 起点或终点在墙上
+    for (BitGrid* b : { &seenBits, &frontBits, &nextBits, &levelBits[0], &levelBits[1] }) {
+        if (b->rows() != rows || b->words() != nw) b->assign(rows, maze.cols);
+        else b->clear();
+    }
+    wordStamp.assign((size_t)rows * nw, -1);
+    activeWords.clear();
+    frontBits.set(maze.startX, maze.startY);
+    seenBits.set(maze.startX, maze.startY);
+    activeWords.push_back(maze.startX * nw + (maze.startY >> 6));
+    int level = 0;
+    bool found = maze.startX == maze.endX && maze.startY == maze.endY;
+    while (!found && !activeWords.empty()) {
+        ++level;
+        int code = level % 3;
+        // 候选字：前沿字本身及其上下左右相邻字
+        nextWords.clear();
+        for (int a : activeWords) {
+            int r = a / nw, w = a % nw;
+            int cand[5] = { a, w > 0 ? a - 1 : -1, w + 1 < nw ? a + 1 : -1, r > 0 ? a - nw : -1, r + 1 < rows ? a + nw : -1 };
+            for (int c : cand)
+                if (c >= 0 && wordStamp[c] != level) {
+                    wordStamp[c] = level;
+                    nextWords.push_back(c);
+                }
+        }
+        int kept = 0;
+        for (int c : nextWords) {
+            int r = c / nw, w = c % nw;
+            const uint64_t* mid = frontBits.row(r);
+            uint64_t f = mid[w];
+            uint64_t left = (f << 1) | (w > 0 ? mid[w - 1] >> 63 : 0);
+            uint64_t right = (f >> 1) | (w + 1 < nw ? mid[w + 1] << 63 : 0);
+            uint64_t n = (left | right | frontBits.row(r - 1)[w] | frontBits.row(r + 1)[w])
+                & pass.row(r)[w] & ~seenBits.row(r)[w];
+            if (!n) continue;
+            nextBits.row(r)[w] = n;
+            seenBits.row(r)[w] |= n;
+            if (code & 1) levelBits[0].row(r)[w] |= n;
+            if (code & 2) levelBits[1].row(r)[w] |= n;
+            nextWords[kept++] = c;
+        }
+        nextWords.resize(kept);
+        // 旧前沿清零后与新前沿交换
+        for (int a : activeWords) frontBits.row(a / nw)[a % nw] = 0;
+        swap(frontBits, nextBits);
+        activeWords.swap(nextWords);
+        found = seenBits.test(maze.endX, maze.endY);
+    }
+    for (int a : activeWords) frontBits.row(a / nw)[a % nw] = 0;
+
+    for (int r = 0; r < rows; r++) {
+        const uint64_t* seen = seenBits.row(r);
+        for (int w = 0; w < nw; w++) {
+            uint64_t v = seen[w];
+            while (v) { v &= v - 1; res.visitedCount++; }
+        }
+    }
+    if (!found) return;
+
+    // 回溯：相邻格子层号差 1，mod 3 即可唯一区分上一层
+    vector<pair<int, int>>& cells = res.path;
+    cells.clear();
+    int x = maze.endX, y = maze.endY;
+    cells.push_back({ x, y });
+    for (int d = level; d > 0; d--) {
+        int want = (d - 1) % 3;
+        for (int i = 0; i < 4; i++) {
+            int nx = x + dx[i], ny = y + dy[i];
+            if (nx < 0 || nx >= rows || ny < 0 || ny >= maze.cols || !seenBits.test(nx, ny)) continue;
+            int c = (int)levelBits[0].test(nx, ny) | ((int)levelBits[1].test(nx, ny) << 1);
+            if (c == want) { x = nx; y = ny; break; }
+        }
+        cells.push_back({ x, y });
+    }
+    reverse(cells.begin(), cells.end());
+    if (bitsOnly()) {                       // 没有字节网格：直接给出坐标路径
+        res.found = true;
+        res.pathLen = (int)cells.size();
+        if (obs) {
+            for (size_t k = cells.size(); k-- > 0; ) obs->onPathCell(cells[k].first, cells[k].second);
+            obs->onStats(res.visitedCount, res.pathLen);
+        }
+        return;
+    }
+    pathIds.clear();
+    for (auto& c : cells) pathIds.push_back(maze.map.id(c.first, c.second));
+    emitPath();
+}
+
+// 字内填充：种子沿可走位向两侧延伸到段尾（段跨字时由调用方续到相邻字）
+static uint64_t fillWord(uint64_t x, uint64_t p) {
+    uint64_t g = (((p + x) ^ p) & p) | x;  // 向高位：加法进位一次填满
+    g |= p & (g >> 1);  p &= p >> 1;       // 向低位：倍增移位
+    g |= p & (g >> 2);  p &= p >> 2;
+    g |= p & (g >> 4);  p &= p >> 4;
+    g |= p & (g >> 8);  p &= p >> 8;
+    g |= p & (g >> 16); p &= p >> 16;
+    g |= p & (g >> 32);
+    return g;
+}
+
+// 连通区域：以 64 格的字为单位泛洪，字内整段一次填满；只求可达，不求距离
+int MazeSolverCore::countReachable(bool* endReached) {
+    if (!isReady() && !bitsOnly()) return 0;
+    const BitGrid& pass = passBits;
+    int rows = maze.rows, nw = pass.words();
+    if (seenBits.rows() != rows || seenBits.words() != nw) seenBits.assign(rows, maze.cols);
+    else seenBits.clear();
+    wordStamp.assign((size_t)rows * nw, 0);    // 1 表示在待处理栈中
+    activeWords.clear();
+    int first = maze.startX * nw + (maze.startY >> 6);
+    uint64_t startBit = (uint64_t)1 << (maze.startY & 63);
+    activeWords.push_back(first);
+    wordStamp[first] = 1;
+    while (!activeWords.empty()) {
+        int a = activeWords.back();
+        activeWords.pop_back();
+        wordStamp[a] = 0;
+        int r = a / nw, w = a % nw;
+        uint64_t* s = seenBits.row(r);
+        uint64_t p = pass.row(r)[w];
+        uint64_t seed = (seenBits.row(r - 1)[w] | seenBits.row(r + 1)[w]);
+        if (w > 0) seed |= s[w - 1] >> 63;
+        if (w + 1 < nw) seed |= s[w + 1] << 63;
+        if (a == first) seed |= startBit;
+        seed &= p & ~s[w];
+        if (!seed) continue;
+        uint64_t f = fillWord(s[w] | seed, p);
+        uint64_t fresh = f & ~s[w];
+        s[w] = f;
+        int nb[4] = { -1, -1, -1, -1 };
+        if (r > 0 && (fresh & pass.row(r - 1)[w])) nb[0] = a - nw;
+        if (r + 1 < rows && (fresh & pass.row(r + 1)[w])) nb[1] = a + nw;
+        if (w > 0 && (fresh & 1)) nb[2] = a - 1;
+        if (w + 1 < nw && (fresh >> 63)) nb[3] = a + 1;
+        for (int c : nb)
+            if (c >= 0 && !wordStamp[c]) { wordStamp[c] = 1; activeWords.push_back(c); }
+    }
+    if (endReached) *endReached = seenBits.test(maze.endX, maze.endY);
+    int count = 0;
+    for (int r = 0; r < rows; r++) {
+        const uint64_t* seen = seenBits.row(r);
+        for (int w = 0; w < nw; w++) {
+            uint64_t v = seen[w];
+            while (v) { v &= v - 1; count++; }
+        }
+    }
+    return count;
+}
@@ -0,0 +1,37 @@
+﻿#pragma once
+// 位图网格：每格 1 bit，每行按 64 位字对齐，上下各留一行全 0 哨兵。
+// 也可只读引用外部同样布局的内存（如内存映射的二进制地图），此时不拥有数据
+#include <cstdint>
+#include <vector>
+
+class BitGrid {
+private:
+    std::vector<uint64_t> bits;
+    const uint64_t* ext = nullptr;  // 非空时为只读引用
+    int nRows = 0, nWords = 0;  // nWords 为每行字数
+
+public:
+    void assign(int rows, int cols) {
+        nRows = rows; nWords = (cols + 63) / 64;
+        bits.assign((size_t)(rows + 2) * nWords, 0);
+        ext = nullptr;
+    }
+    // 引用外部 (rows + 2) * 字数 个字（含哨兵行），外部内存须在使用期间保持有效
+    void attach(int rows, int cols, const uint64_t* data) {
+        nRows = rows; nWords = (cols + 63) / 64;
+        bits.clear();
+        ext = data;
+    }
+    void clear() { bits.assign(bits.size(), 0); }
+
+    int rows() const { return nRows; }
+    int words() const { return nWords; }
+    size_t bytes() const { return bits.size() * sizeof(uint64_t); }
+
+    // 第 x 行首字，x 可取 -1 和 rows（哨兵行）；可写版本只用于自有数据
+    uint64_t* row(int x) { return &bits[(size_t)(x + 1) * nWords]; }
+    const uint64_t* row(int x) const { return (ext ? ext : bits.data()) + (size_t)(x + 1) * nWords; }
+
+    bool test(int x, int y) const { return (row(x)[y >> 6] >> (y & 63)) & 1; }
+    void set(int x, int y) { row(x)[y >> 6] |= (uint64_t)1 << (y & 63); }
+};
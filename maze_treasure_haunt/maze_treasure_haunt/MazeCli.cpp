@@ -0,0 +1,214 @@
+// 命令行求解器：加载 maze.txt 格式地图，全速运行各算法并输出统计
+#include "MazeCore.h"
+#include "MazeBinary.h"
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static void usage() {
+    cout << "用法: maze_cli <map.txt> [选项] [算法...]\n"
+         << "      maze_cli --gen <rows> <cols> [选项] [算法...]\n"
+         << "      maze_cli --stream <out.txt> <rows> <cols> [--seed N]   用 Eller 算法逐行生成并写盘\n"
+         << "      maze_cli --convert <in> <out>   转换地图格式，out 以 .mazb 结尾时写二进制格式\n"
+         << "地图: maze.txt 文本格式或 .mazb 二进制格式（每格 1 bit，内存映射；只跑 bitbfs 时直接用映射的位图，\n"
+         << "      其余算法先展开为字节网格）\n"
+         << "算法: dfs bfs astar dial bibfs biastar jps bitbfs pbfs field corridor hpa kpaths count all（默认 dfs bfs astar）\n"
+         << "      dial 为使用桶队列开放表的 A*，jps 为跳点搜索，bitbfs 为位并行 BFS，pbfs 为多线程 BFS\n"
+         << "      field 为终点距离场（反向 BFS 一次，之后按距离下降）\n"
+         << "      corridor 为走廊收缩图上的 A*\n"
+         << "      hpa 为分簇抽象图上的 HPA*（近似最优）\n"
+         << "      kpaths 为 K 条最短简单路径（Yen 算法）\n"
+         << "      count 为简单路径总数（前沿动态规划，不枚举路径，适合宽度约 20 以内）\n"
+         << "选项: --limit N   全路径模式最大条数（默认 10）\n"
+         << "      --k N       kpaths 求的路径条数（默认 10）\n"
+         << "      --budget MS 全路径模式的时间上限（毫秒，默认不限）\n"
+         << "      --print     打印带路径的地图\n"
+         << "      --threads N pbfs 与 tiled 生成使用的线程数（默认 CPU 核数）\n"
+         << "      --fill      求解前先填充死胡同（作用于 dfs bfs astar dial bibfs biastar all）\n"
+         << "      --seed N    --gen 使用的随机种子（默认按时钟，相同种子生成相同迷宫）\n"
+         << "      --gen-algo A  生成算法: backtrack kruskal wilson eller tiled（默认 backtrack；tiled 按 --threads 并行）\n"
+         << "      --save F    保存地图（F 以 .mazb 结尾时为二进制格式，否则为 maze.txt 格式）\n";
+}
+
+static bool isBinaryName(const string& f) {
+    return f.size() > 5 && f.compare(f.size() - 5, 5, ".mazb") == 0;
+}
+
+// 按扩展名选择格式保存
+static bool saveByName(const string& f, const MazeData& maze, string& err) {
+    return isBinaryName(f) ? saveMazeBinary(f, maze, err) : saveMazeFile(f, maze, err);
+}
+
+// 打印迷宫，S/E 为起终点，$ 为路径
+static void printResult(const MazeData& m, const SolveResult& r) {
+    vector<string> rows(m.rows, string());
+    for (int i = 0; i < m.rows; i++) {
+        for (int j = 0; j < m.cols; j++) rows[i] += (m.map.at(i, j) == WALL) ? "| " : ". ";
+    }
+    for (auto& p : r.path) rows[p.first][p.second * 2] = '$';
+    rows[m.startX][m.startY * 2] = 'S';
+    rows[m.endX][m.endY * 2] = 'E';
+    for (auto& s : rows) cout << s << "\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) { usage(); return 1; }
+    MazeData maze;
+    vector<string> algos;
+    int limit = 10;
+    int kPaths = 10;
+    double budget = 0;
+    int threads = (int)thread::hardware_concurrency();
+    bool print = false;
+    bool fill = false;
+    bool gen = false;
+    unsigned long long seed = 0;
+    MazeGenAlgo genAlgo = GEN_BACKTRACK;
+    string saveFile;
+    int argi = 1;
+    if (strcmp(argv[1], "--stream") == 0) {
+        if (argc < 5) { usage(); return 1; }
+        uint64_t streamSeed = (argc >= 7 && strcmp(argv[5], "--seed") == 0) ? strtoull(argv[6], nullptr, 10) : 0;
+        string err;
+        auto t0 = chrono::steady_clock::now();
+        if (!streamEllerMaze(argv[2], atoi(argv[3]), atoi(argv[4]), streamSeed, err)) { cerr << "错误: " << err << endl; return 1; }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        printf("已写出 %s  种子 %llu  耗时 %.3f ms\n", argv[2], (unsigned long long)streamSeed, ms);
+        return 0;
+    }
+    if (strcmp(argv[1], "--convert") == 0) {
+        if (argc < 4) { usage(); return 1; }
+        string err;
+        auto t0 = chrono::steady_clock::now();
+        if (!loadMazeFile(argv[2], maze, err) || !saveByName(argv[3], maze, err)) { cerr << "错误: " << err << endl; return 1; }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        printf("已转换 %s -> %s（%dx%d）  耗时 %.3f ms\n", argv[2], argv[3], maze.rows, maze.cols, ms);
+        return 0;
+    }
+    MazeBinaryFile binFile;             // .mazb 地图保持映射；只跑 bitbfs 时不展开，直接用映射的位图
+    bool binary = false;
+    if (strcmp(argv[1], "--gen") == 0) {
+        if (argc < 4) { usage(); return 1; }
+        gen = true;
+        argi = 4;
+    }else if (isBinaryName(argv[1])) {
+        string err;
+        if (!binFile.open(argv[1], err)) { cerr << "错误: " << err << endl; return 1; }
+        binary = true;
+        argi = 2;
+    }else {
+        string err;
+        if (!loadMazeFile(argv[1], maze, err)) { cerr << "错误: " << err << endl; return 1; }
+        argi = 2;
+    }
+    for (; argi < argc; argi++) {
+        string a = argv[argi];
+        if (a == "--limit" && argi + 1 < argc) limit = atoi(argv[++argi]);
+        else if (a == "--k" && argi + 1 < argc) kPaths = atoi(argv[++argi]);
+        else if (a == "--budget" && argi + 1 < argc) budget = atof(argv[++argi]);
+        else if (a == "--print") print = true;
+        else if (a == "--fill") fill = true;
+        else if (a == "--threads" && argi + 1 < argc) threads = atoi(argv[++argi]);
+        else if (a == "--seed" && argi + 1 < argc) seed = strtoull(argv[++argi], nullptr, 10);
+        else if (a == "--gen-algo" && argi + 1 < argc) {
+            if (!parseGenAlgo(argv[++argi], genAlgo)) { usage(); return 1; }
+        }
+        else if (a == "--save" && argi + 1 < argc) saveFile = argv[++argi];
+        else if (a == "dfs" || a == "bfs" || a == "astar" || a == "dial" || a == "bibfs" || a == "biastar" || a == "jps" || a == "bitbfs" || a == "pbfs" || a == "field" || a == "corridor" || a == "hpa" || a == "kpaths" || a == "count" || a == "all") algos.push_back(a);
+        else { usage(); return 1; }
+    }
+    if (algos.empty()) algos = { "dfs", "bfs", "astar" };
+    // 逐格算法、打印、填充与保存需要字节网格，只有全部为 bitbfs 时才跳过展开
+    bool bitsOnly = binary && !print && !fill && saveFile.empty() &&
+        all_of(algos.begin(), algos.end(), [](const string& a) { return a == "bitbfs"; });
+    if (binary) {
+        if (bitsOnly) binFile.describe(maze);
+        else binFile.unpack(maze);
+    }
+    if (gen) {
+        auto t0 = chrono::steady_clock::now();
+        if (genAlgo == GEN_TILED) generateTiledMaze(maze, atoi(argv[2]), atoi(argv[3]), seed, threads);
+        else generateMazeData(maze, atoi(argv[2]), atoi(argv[3]), seed, genAlgo);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        printf("生成 %dx%d 迷宫（%s）  种子 %llu  耗时 %.3f ms\n", maze.rows, maze.cols, genAlgoName(genAlgo),
+            (unsigned long long)maze.seed, ms);
+    }
+    if (!saveFile.empty()) {
+        string err;
+        if (!saveByName(saveFile, maze, err)) { cerr << "错误: " << err << endl; return 1; }
+        printf("已保存到 %s\n", saveFile.c_str());
+    }
+
+    MazeSolverCore solver;
+    if (bitsOnly) solver.setMazeBits(maze, binFile.bits());
+    else solver.setMaze(maze, binary ? &binFile.bits() : nullptr);
+    solver.setThreads(threads);
+    printf("地图 %dx%d  起点(%d,%d)  终点(%d,%d)\n", maze.rows, maze.cols,
+        maze.startX, maze.startY, maze.endX, maze.endY);
+    if (fill) {
+        DeadEndStats st = solver.fillDeadEnds();
+        printf("死胡同填充: %d / %d 个通路格子被填（%.1f%%），耗时 %.3f ms\n", st.filledCells, st.roadCells,
+            st.roadCells ? 100.0 * st.filledCells / st.roadCells : 0.0, st.ms);
+    }
+    printf("%-8s %-6s %10s %12s %12s\n", "algo", "found", "pathLen", "visited", "time(ms)");
+    for (auto& a : algos) {
+        auto t0 = chrono::steady_clock::now();
+        SolveResult r;
+        if (a == "dfs") r = solver.solveDFS();
+        else if (a == "bfs") r = solver.solveBFS();
+        else if (a == "astar") r = solver.solveAStar();
+        else if (a == "dial") r = solver.solveAStar(nullptr, OPEN_BUCKET);
+        else if (a == "bibfs") r = solver.solveBiBFS();
+        else if (a == "biastar") r = solver.solveBiAStar();
+        else if (a == "jps") r = solver.solveJPS();
+        else if (a == "bitbfs") r = solver.solveBFS(nullptr, BFS_BITSET);
+        else if (a == "pbfs") r = solver.solveBFS(nullptr, BFS_PARALLEL);
+        else if (a == "field") r = solver.solveDistField();
+        else if (a == "corridor") r = solver.solveCorridor();
+        else if (a == "hpa") r = solver.solveHPA();
+        else if (a == "kpaths") {
+            vector<vector<pair<int, int>>> paths;
+            KPathsStats st = solver.solveKShortest(kPaths, paths);
+            r.found = st.paths > 0;
+            r.pathCount = st.paths;
+            r.visitedCount = (int)min(st.treeHits + st.searches, (long long)INT32_MAX);
+            if (r.found) {
+                r.path = paths.front();
+                r.pathLen = (int)r.path.size();
+            }
+            printf("K 短路: %d 条，长度 %d..%d，偏离点 %lld，树下降 %lld，A* %lld\n", st.paths,
+                r.found ? (int)paths.front().size() : 0, r.found ? (int)paths.back().size() : 0,
+                st.spurNodes, st.treeHits, st.searches);
+        }
+        else if (a == "count") {
+            PathCountStats st = countSimplePaths(maze);
+            r.found = st.ok && st.count != "0";
+            if (st.ok) printf("简单路径数: %s（前沿宽度 %d，状态峰值 %zu）\n", st.count.c_str(), st.width, st.peakStates);
+            else printf("简单路径数: 前沿宽度 %d 时状态数超出上限\n", st.width);
+        }
+        else {
+            AllPathsOptions opt;
+            opt.limit = limit;
+            opt.timeBudgetMs = budget;
+            AllPathsStats st = solver.enumeratePaths(opt);
+            r.found = st.paths > 0;
+            r.pathCount = (int)st.paths;
+            r.visitedCount = (int)min(st.steps, (long long)INT32_MAX);
+            printf("全路径: 搜索区域 %d 格，分支检查 %lld 次，%s\n", st.regionCells, st.reachChecks,
+                st.complete ? "已全部列出" : st.timedOut ? "达到时间上限" : "达到条数上限");
+        }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+        int len = (a == "all") ? r.pathCount : r.pathLen;
+        printf("%-8s %-6s %10d %12d %12.3f\n", a.c_str(), r.found ? "yes" : "no", len, r.visitedCount, ms);
+        if (print && r.found && a != "all") printResult(maze, r);
+    }
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include "MazeCore.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+// 设置地图并按尺寸准备搜索缓冲区
+void MazeSolverCore::setMaze(const MazeData& m, const BitGrid* pass) {
+    maze = m;
+    workMap.assign(maze.map);
+    maze.map.neighborOffsets(off);
+    startId = maze.map.id(maze.startX, maze.startY);
+    endId = maze.map.id(maze.endX, maze.endY);
+    parentDir.resize(maze.map.size());
+    openHeap.resize(maze.map.size());
+    parentDirRev.resize(maze.map.size());
+    openHeapRev.resize(maze.map.size());
+    minG.resize(0, INT_MAX);                // G 值表在首次 A* 时再分配
+    minGRev.resize(0, INT_MAX);
+    mazeKey = hashMazeData(maze);           // 内容变化（重新加载 / 生成）时距离场随之失效
+    if (pass && pass->rows() == maze.rows && pass->words() == (maze.cols + 63) / 64) {
+        passBits = *pass;                   // 引用时只复制指针
+    }else {
+        passBits.assign(maze.rows, maze.cols);
+        for (int i = 0; i < maze.rows; i++)
+            for (int j = 0; j < maze.cols; j++)
+                if (maze.map.at(i, j) != WALL) passBits.set(i, j);
+    }
+}
+
+void MazeSolverCore::setMazeBits(const MazeData& m, const BitGrid& pass) {
+    maze = m;
+    maze.map = MazeGrid();
+    workMap.assign(maze.map);
+    startId = endId = -1;
+    mazeKey = 0;
+    passBits = pass;
+}
+
+// 重置工作地图：只推进代数，O(1)（前驱表只在已访问格子上读取，无需清空）
+void MazeSolverCore::reset() {
+    workMap.nextEpoch();
+    minG.nextEpoch();
+    minGRev.nextEpoch();
+    frontier.clear();
+    frontierRev.clear();
+    frontierNext.clear();
+}
+
+// 每次求解前的公共准备
+void MazeSolverCore::begin(SearchObserver* o) {
+    reset();
+    obs = o;
+    res = SolveResult();
+}
+
+// 回溯路径：从终点沿前驱方向走回起点
+void MazeSolverCore::markPath(int endNode) {
+    pathIds.clear();
+    for (int cur = endNode; ; cur -= off[parentDir.get(cur)]) {
+        pathIds.push_back(cur);
+        if (cur == startId) break;
+    }
+    reverse(pathIds.begin(), pathIds.end());
+    emitPath();
+}
+
+// 输出 pathIds（起点到终点）：写入结果，并按终点到起点的顺序通知界面
+void MazeSolverCore::emitPath() {
+    int len = (int)pathIds.size();
+    res.path.resize(len);
+    for (int k = len - 1; k >= 0; k--) {
+        int cur = pathIds[k];
+        int x = maze.map.toX(cur), y = maze.map.toY(cur);
+        workMap.set(cur, PATH);
+        res.path[k] = { x, y };
+        if (obs) obs->onPathCell(x, y);
+    }
+    res.found = true;
+    res.pathLen = len;
+    if (obs) obs->onStats(res.visitedCount, len);
+}
+
+// DFS
+SolveResult MazeSolverCore::solveDFS(SearchObserver* o) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!endsOpen()) return res;
+    vector<int>& s = frontier;
+    s.push_back(startId);
+    workMap.set(startId, VISITED);
+    while (!s.empty()) {
+        int cur = s.back(); s.pop_back();
+        ++res.visitedCount;
+        if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(maze.map.toX(cur), maze.map.toY(cur)); }
+        // 找到终点
+        if (cur == endId) { markPath(cur); break; }
+        if (obs) obs->onVisited(maze.map.toX(cur), maze.map.toY(cur));
+        // 逆序入栈，保证正向DFS顺序
+        for (int i = 3; i >= 0; i--) {
+            int nid = cur + off[i];
+            if (isValid(nid, workMap) && workMap[nid] != VISITED) {
+                workMap.set(nid, VISITED);
+                parentDir.set(nid, i);
+                s.push_back(nid);
+            }
+        }
+    }
+    return res;
+}
+
+// BFS（队列为复用的数组，head 之前的元素即已出队）
+SolveResult MazeSolverCore::solveBFS(SearchObserver* o, BfsMode mode) {
+    if (mode == BFS_BITSET && bitsOnly()) { begin(o); runBitBFS(); return res; }
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!endsOpen()) return res;
+    if (mode == BFS_BITSET) { runBitBFS(); return res; }
+    if (mode == BFS_PARALLEL) { runParallelBFS(); return res; }
+    vector<int>& q = frontier;
+    size_t head = 0;
+    q.push_back(startId);
+    workMap.set(startId, VISITED);
+    while (head < q.size()) {
+        int cur = q[head++];
+        ++res.visitedCount;
+        if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(maze.map.toX(cur), maze.map.toY(cur)); }
+        if (cur == endId) { markPath(cur); break; }
+        if (obs) obs->onVisited(maze.map.toX(cur), maze.map.toY(cur));
+        for (int i = 0; i < 4; i++) {
+            int nid = cur + off[i];
+            if (isValid(nid, workMap) && workMap[nid] != VISITED) {
+                workMap.set(nid, VISITED);
+                parentDir.set(nid, i);
+                q.push_back(nid);
+            }
+        }
+    }
+    return res;
+}
+
+// A* 主循环：开放表可为索引堆或桶队列，关闭集保证每个格子至多扩展一次
+template <class OpenList>
+void MazeSolverCore::runAStar(OpenList& open) {
+    const int INF = INT_MAX;
+    if (minG.size() != maze.map.size()) minG.resize(maze.map.size(), INF);
+    open.push({ calcH(startId), 0, startId });
+    minG.set(startId, 0);
+    while (!open.empty()) {
+        OpenEntry cur = open.pop();        // 取出 F 值最小的
+        if (cur.g > minG[cur.id]) continue; // 桶队列中的过期条目
+        ++res.visitedCount;
+        int cx = maze.map.toX(cur.id); int cy = maze.map.toY(cur.id);
+        if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(cx, cy); }
+        if (cur.id == endId) { markPath(cur.id); break; }
+        workMap.set(cur.id, VISITED);         // 加入关闭集
+        if (obs) obs->onVisited(cx, cy);
+        for (int i = 0; i < 4; i++) {
+            int nid = cur.id + off[i];
+            if (!isValid(nid, workMap) || workMap[nid] == VISITED) continue;
+            int newG = cur.g + 1;
+            if (newG < minG[nid]) {       // 只有发现更短的路径才更新
+                OpenEntry e = { newG + calcH(nid), newG, nid };
+                if (minG[nid] != INF) { open.decrease(e); res.decreaseKeys++; }
+                else open.push(e);
+                minG.set(nid, newG);
+                parentDir.set(nid, i);
+            }
+        }
+    }
+}
+
+// A*
+SolveResult MazeSolverCore::solveAStar(SearchObserver* o, OpenListType type) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!endsOpen()) return res;
+    if (type == OPEN_BUCKET) {
+        openBuckets.clear(calcH(startId));
+        runAStar(openBuckets);
+    }else {
+        openHeap.clear();
+        runAStar(openHeap);
+    }
+    return res;
+}
+
@@ -0,0 +1,301 @@
+﻿#pragma once
+// 迷宫求解核心：不依赖 EasyX，可在 Linux 下独立编译运行
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include "MazeGrid.h"
+#include "MazeHeap.h"
+#include "MazeBitGrid.h"
+#include "MazeThreadPool.h"
+#include "MazeCorridor.h"
+#include "MazeHpa.h"
+
+// 地图状态常量
+const int WALL = 0;
+const int ROAD = 1;
+const int VISITED = 2;
+const int PATH = 3;
+const int VISITED_REV = 4;  // 双向搜索：反向一侧已访问
+
+// 迷宫数据
+struct MazeData {
+    MazeGrid map;
+    int rows = 0, cols = 0;
+    int startX = 0, startY = 0, endX = 0, endY = 0;
+    uint64_t seed = 0;          // 生成所用的种子，从文件加载的地图为 0
+
+    bool empty() const { return map.empty() || rows == 0 || cols == 0; }
+};
+
+// 读取 maze.txt 格式：行列数、'|'/'.' 网格（地图每行占文件一行）、起点、终点。
+// 文件整体内存映射后解析，出错时 err 以“第 L 行第 C 列”开头
+bool loadMazeFile(const std::string& fname, MazeData& maze, std::string& err);
+
+// 按 maze.txt 格式写出地图（二进制格式见 MazeBinary.h，loadMazeFile 按文件头自动识别）
+bool saveMazeFile(const std::string& fname, const MazeData& maze, std::string& err);
+
+// 生成算法：回溯（长走廊）、Kruskal（并查集）、Wilson（均匀生成树）、Eller（逐行，O(列数) 内存）、
+// 分块（各块多线程回溯后拼接）
+enum MazeGenAlgo {
+    GEN_BACKTRACK = 0,
+    GEN_KRUSKAL = 1,
+    GEN_WILSON = 2,
+    GEN_ELLER = 3,
+    GEN_TILED = 4
+};
+bool parseGenAlgo(const std::string& name, MazeGenAlgo& algo);
+const char* genAlgoName(MazeGenAlgo algo);
+
+// 生成完美迷宫（奇数尺寸保证围墙完整），任意尺寸（每边至少 3），起点 (1,1)，终点为右下角的格子。
+// seed 相同则结果相同；seed 为 0 时按时钟取种子，实际种子记入 maze.seed
+void generateMazeData(MazeData& maze, int rows = 21, int cols = 29, uint64_t seed = 0, MazeGenAlgo algo = GEN_BACKTRACK);
+// 分块并行生成：tileCells x tileCells 个格子为一块，各块并行回溯，再沿块间随机生成树打通边界。
+// 结果只由种子与块大小决定，与线程数无关；GEN_TILED 使用全部 CPU 核与默认块大小
+void generateTiledMaze(MazeData& maze, int rows, int cols, uint64_t seed, int threads, int tileCells = 128);
+// Eller 算法逐行生成并直接写入文件，内存只与列数有关，行数不受限制；seed 为 0 时改写为实际种子
+bool streamEllerMaze(const std::string& fname, int rows, int cols, uint64_t& seed, std::string& err);
+
+// 地图内容哈希（FNV-1a）：尺寸、网格与终点，用作距离场缓存的键
+uint64_t hashMazeData(const MazeData& maze);
+
+// 起点到终点的简单路径总数（精确值，十进制大整数）
+struct PathCountStats {
+    bool ok = false;            // 前沿过宽或状态数超出上限时为 false
+    std::string count;
+    int width = 0;              // 前沿宽度：行列中较小者，状态按此方向逐行推进
+    size_t peakStates = 0;      // 单个格子处最多的连通状态数
+    int limbs = 0;              // 计数所用的 32 位字数
+    double ms = 0;
+};
+// 前沿动态规划（插头 DP）：逐格推进，状态为前沿上各插头的括号配对，路径不展开，
+// 适合宽度约 20 以内的地图；maxStates 为单层状态数上限
+PathCountStats countSimplePaths(const MazeData& maze, size_t maxStates = (size_t)1 << 24);
+
+// 搜索过程观察者：默认全部为空操作，界面层按需重写
+class SearchObserver {
+public:
+    virtual ~SearchObserver() {}
+    virtual void onStats(int /*visited*/, int /*pathLen*/) {}   // 统计更新
+    virtual void onCurrent(int /*x*/, int /*y*/) {}             // 当前出队节点
+    virtual void onVisited(int /*x*/, int /*y*/) {}             // 节点扩展完毕
+    virtual void onPathCell(int /*x*/, int /*y*/) {}            // 回溯最终路径（终点到起点）
+    virtual void onStepIn(int /*x*/, int /*y*/) {}              // 全路径：进入格子
+    virtual void onStepOut(int /*x*/, int /*y*/) {}             // 全路径：回溯离开格子
+    virtual void onPathFound(int /*index*/) {}                  // 全路径：找到第 index 条
+};
+
+// A* 开放表类型
+enum OpenListType {
+    OPEN_HEAP = 0,      // 索引 4 叉堆
+    OPEN_BUCKET = 1     // 桶队列（Dial）
+};
+
+// BFS 实现方式
+enum BfsMode {
+    BFS_QUEUE = 0,      // 逐格出队
+    BFS_BITSET = 1,     // 位并行：按层整行移位扩展，每条指令处理 64 格
+    BFS_PARALLEL = 2    // 多线程按层同步：前沿分块并行扩展，路径与 BFS_QUEUE 完全一致
+};
+
+// 死胡同填充统计
+struct DeadEndStats {
+    int roadCells = 0;      // 填充前的通路格子数
+    int filledCells = 0;    // 被填成墙的格子数
+    double ms = 0;
+};
+
+// 求解结果
+struct SolveResult {
+    bool found = false;
+    int pathLen = 0;        // 路径格子数（含起点终点）
+    int visitedCount = 0;   // 出队/访问节点数
+    int pathCount = 0;      // 全路径模式下找到的条数
+    int decreaseKeys = 0;   // A*：decrease-key 次数，即旧的重复入队/过期出队数
+    std::vector<std::pair<int, int>> path; // 起点到终点
+};
+
+// 全路径枚举选项：limit、timeBudgetMs 不大于 0 表示不限；
+// onPath 每找到一条路径回调一次（起点到终点的格子坐标），返回 false 则提前结束
+struct AllPathsOptions {
+    long long limit = 10;
+    double timeBudgetMs = 0;
+    bool prune = true;      // 双连通分量限定搜索区域 + 分支处终点可达性检查
+    std::function<bool(const std::vector<std::pair<int, int>>&)> onPath;
+};
+
+struct AllPathsStats {
+    long long paths = 0;
+    long long steps = 0;        // 进入格子的次数
+    long long reachChecks = 0;  // 分支处的可达性 BFS 次数
+    int regionCells = 0;        // 参与搜索的格子数（剪枝时为起终点之间的双连通分量链）
+    bool complete = false;      // 已枚举全部路径（未因条数、时间或回调停止）
+    bool timedOut = false;
+    double ms = 0;
+};
+
+// K 条最短简单路径的统计
+struct KPathsStats {
+    int paths = 0;
+    long long spurNodes = 0;    // 考察的偏离点数
+    long long treeHits = 0;     // 沿最短路径树直接下降即得偏离路径
+    long long searches = 0;     // 退回 A* 的偏离搜索次数
+    long long bounded = 0;      // 下界不优于候选集中最差者而跳过的偏离点
+    double ms = 0;
+};
+
+// 无界面求解器
+class MazeSolverCore {
+private:
+    MazeData maze;
+    EpochGrid workMap;                     // 工作地图：按代数戳记访问状态
+    int dx[4] = { 0, 1, 0, -1 };
+    int dy[4] = { 1, 0, -1, 0 };
+    int off[4] = { 0, 0, 0, 0 };           // 与 dx/dy 对应的格子编号偏移
+    int startId = 0, endId = 0;
+    ParentDirs parentDir;                  // 前驱方向表，每格 2 bit
+    std::vector<int> frontier;             // DFS 栈 / BFS 队列，跨搜索复用
+    EpochTable minG;                       // A* 最小 G 值表，未写入读作 INT_MAX
+    IndexedHeap openHeap;                  // A* 开放表：索引堆
+    // 双向搜索的反向一侧
+    ParentDirs parentDirRev;               // 反向前驱：指向终点方向
+    std::vector<int> frontierRev, frontierNext;
+    EpochTable minGRev;
+    IndexedHeap openHeapRev;
+    std::vector<int> pathIds;              // 路径格子编号，起点到终点
+    BucketQueue openBuckets;               // A* 开放表：桶队列
+    // 位并行 BFS
+    BitGrid passBits;                      // 可走格子
+    BitGrid seenBits, frontBits, nextBits;
+    BitGrid levelBits[2];                  // 层号 mod 3 的两个位平面，用于回溯路径
+    std::vector<int> activeWords, nextWords;   // 前沿所在字的编号（行 * 每行字数 + 列字）
+    std::vector<int> wordStamp;            // 每字的层号标记 / 是否已在待处理栈中
+    // 多线程 BFS
+    ThreadPool pool;
+    std::unique_ptr<std::atomic<int>[]> claim;  // 发现该格子的前沿在队列中的最小下标，兼作访问标记
+    int claimSize = 0;
+    std::vector<std::vector<int>> chunkFound;   // 每个分块本层新发现的格子
+    // 终点距离场：从终点反向 BFS 得到每格到终点的步数，-1 为不可达
+    std::vector<int> distField;
+    uint64_t distKey = 0;                  // 距离场对应的地图哈希
+    bool distValid = false;
+    uint64_t mazeKey = 0;                  // 当前地图哈希，setMaze 时计算
+    // 走廊收缩图及其上的 A* 缓冲区
+    CorridorGraph corridor;
+    uint64_t corridorKey = 0;
+    bool corridorValid = false;
+    IndexedHeap graphHeap;
+    std::vector<int> nodeG, nodeParent;
+    std::vector<const CorridorGraph::Arc*> nodeArc;
+    // HPA* 分簇抽象，按地图哈希缓存
+    HpaGraph hpa;
+    uint64_t hpaKey = 0;
+    bool hpaValid = false;
+    std::vector<uint8_t> deadEndDeg;       // 死胡同填充：每格剩余的通路邻居数
+    SearchObserver* obs = nullptr;
+    SolveResult res;
+    // 全路径枚举：Tarjan 的发现序 / low 值 / 所属块，搜索区域标记与可达性戳
+    std::vector<int> bccDisc, bccLow, bccBlock;
+    std::vector<uint8_t> pathRegion;
+    std::vector<uint32_t> reachStamp;
+    uint32_t reachEpoch = 0;
+    BucketQueue reachOpen;
+    // K 短路：偏离搜索中被根路径占用的格子（戳等于当前令牌即禁止）
+    std::vector<uint32_t> kBlock;
+    uint32_t kToken = 0;
+    BucketQueue kOpen;
+
+    int calcH(int x, int y) const { return abs(x - maze.endX) + abs(y - maze.endY); }
+    int calcH(int id) const { return calcH(maze.map.toX(id), maze.map.toY(id)); }
+    // 外围有哨兵墙，无需越界判断
+    bool isValid(int id, const EpochGrid& m) const { return m[id] != WALL; }
+    void begin(SearchObserver* o);
+    void markPath(int endNode);
+    void markBiPath(int meetF, int meetB);
+    void emitPath();
+    int markPathRegion(bool prune);
+    uint8_t reachMask(int u, bool prune, AllPathsStats& st);
+    uint32_t nextKToken();
+    bool spurPath(int spur, uint8_t banned, uint32_t token, std::vector<int>& out, KPathsStats& st);
+    template <class OpenList> void runAStar(OpenList& open);
+    int jumpH(int n, int d) const;
+    int jumpV(int n, int d) const;
+    void markJumpPath();
+    void runBitBFS();
+    void runParallelBFS();
+    int buildDistField();
+
+public:
+    MazeSolverCore() {}
+    MazeSolverCore(const MazeSolverCore&) = delete;
+    MazeSolverCore& operator=(const MazeSolverCore&) = delete;
+
+    // pass 非空且尺寸一致时，可走位图直接引用它（如 MazeBinaryFile::bits()），不再由字节网格重建；
+    // 被引用的内存须在求解器使用期间保持有效
+    void setMaze(const MazeData& m, const BitGrid* pass = nullptr);
+    // 只设置尺寸、起终点与可走位图，不需要字节网格（m.map 可为空）：之后只有 solveBFS(BFS_BITSET)
+    // 与 countReachable 可用，其余算法视为未就绪；pass 须在求解器使用期间保持有效
+    void setMazeBits(const MazeData& m, const BitGrid& pass);
+    bool bitsOnly() const { return maze.map.empty() && maze.rows > 0 && passBits.rows() == maze.rows; }
+    const MazeData& data() const { return maze; }
+    bool isReady() const { return !maze.empty(); }
+    // 起点与终点都可走（地图可由程序构造，起终点未必经过加载时的校验）
+    bool endsOpen() const { return maze.map[startId] != WALL && maze.map[endId] != WALL; }
+    const EpochGrid& work() const { return workMap; }
+
+    void reset();
+    // BFS_PARALLEL 使用的线程数（含调用线程），默认 1
+    void setThreads(int n) { pool.resize(n); }
+    int threads() const { return pool.size(); }
+
+    SolveResult solveDFS(SearchObserver* o = nullptr);
+    // BFS_BITSET / BFS_PARALLEL 只通知路径与统计，不逐格回调
+    SolveResult solveBFS(SearchObserver* o = nullptr, BfsMode mode = BFS_QUEUE);
+    SolveResult solveAStar(SearchObserver* o = nullptr, OpenListType type = OPEN_HEAP);
+    // 全路径：显式栈 DFS，逐格通知观察者；pathCount 为找到的条数
+    SolveResult solveAllPaths(SearchObserver* o = nullptr, int limit = 10);
+    // 全路径枚举：只在起终点之间的双连通分量链内搜索，分支处检查终点是否仍可达，
+    // 进入的每个分支都至少通向一条路径；路径通过 opt.onPath 流式输出
+    AllPathsStats enumeratePaths(const AllPathsOptions& opt, SearchObserver* o = nullptr);
+    // K 条最短简单路径（Yen）：终点距离场作为各偏离搜索共用的最短路径树与启发式，
+    // 偏离点沿树下降不受阻时无需搜索；候选集只保留还可能被选中的 k - |A| 条，按下界跳过偏离点。
+    // paths 按长度（格子数）非降序
+    KPathsStats solveKShortest(int k, std::vector<std::vector<std::pair<int, int>>>& paths);
+    // 双向搜索：从两端同时扩展，前沿相遇即停止
+    SolveResult solveBiBFS(SearchObserver* o = nullptr);
+    SolveResult solveBiAStar(SearchObserver* o = nullptr);
+    // 跳点搜索（4 连通 JPS），只扩展跳点，结果与 A* 同为最优路径
+    SolveResult solveJPS(SearchObserver* o = nullptr);
+    // 位并行连通判定：返回起点可达的格子数，endReached 返回终点是否可达
+    int countReachable(bool* endReached = nullptr);
+    // 距离场寻路：首次（或地图内容变化后）反向 BFS 建场，之后任意起点沿距离递减贪心下降，O(路径长度)
+    // visitedCount 为本次建场访问的格子数（命中缓存时为 0）加上下降经过的格子数
+    SolveResult solveDistField(SearchObserver* o = nullptr);
+    SolveResult solveDistField(int sx, int sy, SearchObserver* o = nullptr);
+    int distanceToEnd(int x, int y);       // 不可达或越界返回 -1
+    // 走廊收缩：度为 2 的格子收缩成带权边，在小图上跑 A* 后展开为格子路径
+    // 收缩图按地图内容与起点缓存；visitedCount 为扩展的图节点数
+    SolveResult solveCorridor(SearchObserver* o = nullptr);
+    const CorridorGraph& corridorGraph() const { return corridor; }
+    // HPA*：32x32 分簇的抽象图上 A*，再在簇内细化；近似最优，抽象按地图内容缓存
+    // visitedCount 为抽象图扩展的节点数
+    SolveResult solveHPA(SearchObserver* o = nullptr);
+    const HpaGraph& hpaGraph() const { return hpa; }
+
+    // 死胡同填充：反复把只有一个出口的通路格子（起终点除外）填成墙，沿走廊增量推进，线性时间。
+    // 只作用于工作地图，之后的 DFS / BFS / A* 在剪枝后的地图上搜索；setMaze 或 clearDeadEnds 恢复
+    DeadEndStats fillDeadEnds();
+    void clearDeadEnds() { workMap.assign(maze.map); }
+    bool distFieldCached() const { return distValid && distKey == mazeKey; }
+
+    // 搜索附加内存（字节）：工作地图 + 前驱表 + 栈/队列 + G 值表
+    size_t scratchBytes() const {
+        return workMap.bytes() + parentDir.bytes() + parentDirRev.bytes() + minG.bytes() + minGRev.bytes() +
+            (frontier.capacity() + frontierRev.capacity() + frontierNext.capacity()) * sizeof(int) +
+            seenBits.bytes() + frontBits.bytes() + nextBits.bytes() + levelBits[0].bytes() + levelBits[1].bytes();
+    }
+};
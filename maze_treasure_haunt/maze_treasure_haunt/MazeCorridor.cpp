@@ -0,0 +1,110 @@
+// 走廊收缩图：建图与路径展开，以及在收缩图上的 A*
+#include "MazeCorridor.h"
+#include "MazeCore.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+void CorridorGraph::build(const MazeGrid& map, int startId, int endId) {
+    map.neighborOffsets(off);
+    int n = map.size();
+    nodeIndex.assign(n, -1);
+    nodeCell.clear();
+    // 节点：度不为 2 的通路格子，以及起点和终点
+    for (int x = 0; x < map.rows(); x++) {
+        for (int y = 0; y < map.cols(); y++) {
+            int c = map.id(x, y);
+            if (map[c] == WALL) continue;
+            int deg = 0;
+            for (int i = 0; i < 4; i++) deg += map[c + off[i]] != WALL;
+            if (deg != 2 || c == startId || c == endId) {
+                nodeIndex[c] = (int)nodeCell.size();
+                nodeCell.push_back(c);
+            }
+        }
+    }
+    // 边：从每个节点沿每个方向走到下一个节点，两端各记一条有向边
+    firstArc.assign(nodeCell.size() + 1, 0);
+    arcs.clear();
+    for (int u = 0; u < (int)nodeCell.size(); u++) {
+        firstArc[u] = (int)arcs.size();
+        for (int i = 0; i < 4; i++) {
+            int c = nodeCell[u] + off[i];
+            if (map[c] == WALL) continue;
+            int d = i, w = 1;
+            while (nodeIndex[c] < 0) {
+                d = nextDir(map, c, d);
+                c += off[d];
+                w++;
+            }
+            arcs.push_back({ nodeIndex[c], w, i });
+        }
+    }
+    firstArc[nodeCell.size()] = (int)arcs.size();
+}
+
+void CorridorGraph::expand(const MazeGrid& map, int u, const Arc& a, vector<int>& out) const {
+    int c = nodeCell[u], d = a.dir;
+    for (int k = 0; k < a.w; k++) {
+        c += off[d];
+        out.push_back(c);
+        if (k + 1 < a.w) d = nextDir(map, c, d);
+    }
+}
+
+// 收缩图上的 A*：边权为走廊长度，曼哈顿距离仍是一致的启发式
+SolveResult MazeSolverCore::solveCorridor(SearchObserver* o) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    uint64_t key = mazeKey * 1000003ull + (uint64_t)startId;
+    if (!corridorValid || corridorKey != key) {
+        corridor.build(maze.map, startId, endId);
+        graphHeap.resize(corridor.nodeCount());
+        corridorKey = key;
+        corridorValid = true;
+    }
+    const int INF = INT_MAX;
+    int nn = corridor.nodeCount();
+    int s = corridor.nodeOf(startId), t = corridor.nodeOf(endId);
+    if (s < 0 || t < 0) return res;         // 起点或终点在墙上
+    nodeG.assign(nn, INF);
+    nodeParent.assign(nn, -1);
+    nodeArc.assign(nn, nullptr);
+    graphHeap.clear();
+    graphHeap.push({ calcH(startId), 0, s });
+    nodeG[s] = 0;
+    bool found = false;
+    while (!graphHeap.empty()) {
+        OpenEntry cur = graphHeap.pop();
+        ++res.visitedCount;
+        int cell = corridor.cellOf(cur.id);
+        int cx = maze.map.toX(cell); int cy = maze.map.toY(cell);
+        if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(cx, cy); }
+        if (cur.id == t) { found = true; break; }
+        workMap.set(cell, VISITED);
+        if (obs) obs->onVisited(cx, cy);
+        for (const CorridorGraph::Arc* a = corridor.arcBegin(cur.id); a != corridor.arcEnd(cur.id); ++a) {
+            if (workMap[corridor.cellOf(a->to)] == VISITED) continue;
+            int newG = cur.g + a->w;
+            if (newG >= nodeG[a->to]) continue;
+            OpenEntry e = { newG + calcH(corridor.cellOf(a->to)), newG, a->to };
+            if (nodeG[a->to] != INF) { graphHeap.decrease(e); res.decreaseKeys++; }
+            else graphHeap.push(e);
+            nodeG[a->to] = newG;
+            nodeParent[a->to] = cur.id;
+            nodeArc[a->to] = a;
+        }
+    }
+    if (!found) return res;
+    // 节点链从终点回溯，再逐条边展开成格子路径
+    vector<int>& chain = frontier;
+    chain.clear();
+    for (int v = t; v != s; v = nodeParent[v]) chain.push_back(v);
+    pathIds.clear();
+    pathIds.push_back(startId);
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        corridor.expand(maze.map, nodeParent[*it], *nodeArc[*it], pathIds);
+    emitPath();
+    return res;
+}
@@ -0,0 +1,44 @@
+﻿#pragma once
+// 走廊收缩图：度为 2 的走廊格子收缩成带权边，只保留路口、死胡同以及起点终点作为节点
+#include "MazeGrid.h"
+#include <vector>
+
+class CorridorGraph {
+public:
+    struct Arc {
+        int to;     // 目标节点
+        int w;      // 走廊长度（步数）
+        int dir;    // 从出发节点迈出的第一步方向
+    };
+
+    // 按原始地图建图，startId / endId 强制作为节点
+    void build(const MazeGrid& map, int startId, int endId);
+
+    int nodeCount() const { return (int)nodeCell.size(); }
+    int arcCount() const { return (int)arcs.size(); }
+    int nodeOf(int cell) const { return nodeIndex[cell]; }
+    int cellOf(int node) const { return nodeCell[node]; }
+    const Arc* arcBegin(int node) const { return arcs.data() + firstArc[node]; }
+    const Arc* arcEnd(int node) const { return arcs.data() + firstArc[node + 1]; }
+
+    // 把从节点 u 出发的一条边展开成格子编号追加到 out（不含 u 本身，含目标节点格子）
+    void expand(const MazeGrid& map, int u, const Arc& a, std::vector<int>& out) const;
+
+    size_t bytes() const {
+        return (nodeCell.capacity() + nodeIndex.capacity() + firstArc.capacity()) * sizeof(int) + arcs.capacity() * sizeof(Arc);
+    }
+
+private:
+    std::vector<int> nodeCell;      // 节点 -> 格子编号
+    std::vector<int> nodeIndex;     // 格子编号 -> 节点，-1 表示走廊格子或墙
+    std::vector<int> firstArc;      // CSR：节点 u 的边为 arcs[firstArc[u], firstArc[u+1])
+    std::vector<Arc> arcs;
+    int off[4] = { 0, 0, 0, 0 };
+
+    // 走廊格子 c 由方向 d 进入，返回离开的方向
+    int nextDir(const MazeGrid& map, int c, int d) const {
+        for (int i = 0; i < 4; i++)
+            if (i != ((d + 2) & 3) && map[c + off[i]] != 0) return i;   // 0 为墙
+        return -1;
+    }
+};
@@ -0,0 +1,125 @@
+// D* Lite：改图后只修复局部不一致的格子
+#include "MazeDStar.h"
+#include <chrono>
+#include <climits>
+
+using namespace std;
+
+static const int INF = INT_MAX;
+
+// 键的字典序比较：k1 小者优先，k1 相同时 k2 小者优先（k2 以相反数存放在 g 中）
+static bool keyLess(const OpenEntry& a, const OpenEntry& b) {
+    return a.f < b.f || (a.f == b.f && a.g > b.g);
+}
+
+void DStarLite::setMaze(const MazeData& m) {
+    map = m.map;
+    map.neighborOffsets(off);
+    startId = map.id(m.startX, m.startY);
+    goalId = map.id(m.endX, m.endY);
+    lastId = startId;
+    km = 0;
+    g.assign(map.size(), INF);
+    rhs.assign(map.size(), INF);
+    open.resize(map.size());
+    rhs[goalId] = 0;
+    open.push(calcKey(goalId));
+    pendingUpdates = 0;
+}
+
+OpenEntry DStarLite::calcKey(int id) const {
+    int m = g[id] < rhs[id] ? g[id] : rhs[id];
+    if (m == INF) return { INF, -INF, id };
+    return { m + h(startId, id) + km, -m, id };
+}
+
+// 由后继重新计算 rhs，不一致则（重新）入队，一致则出队
+void DStarLite::updateVertex(int id) {
+    pendingUpdates++;
+    if (id != goalId) {
+        int best = INF;
+        if (map[id] != WALL) {
+            for (int i = 0; i < 4; i++) {
+                int nid = id + off[i];
+                if (map[nid] != WALL && g[nid] != INF && g[nid] + 1 < best) best = g[nid] + 1;
+            }
+        }
+        rhs[id] = best;
+    }
+    if (g[id] != rhs[id]) {
+        if (open.contains(id)) open.update(calcKey(id));
+        else open.push(calcKey(id));
+    }else if (open.contains(id)) open.remove(id);
+}
+
+bool DStarLite::setCell(int x, int y, uint8_t v) {
+    if (!isReady() || !map.inside(x, y) || map.at(x, y) == v) return false;
+    map.at(x, y) = v;
+    int id = map.id(x, y);
+    // 起点已移动过时先把 km 补上，保证队列中旧键仍是下界
+    km += h(lastId, startId);
+    lastId = startId;
+    updateVertex(id);
+    for (int i = 0; i < 4; i++)
+        if (map[id + off[i]] != WALL) updateVertex(id + off[i]);
+    return true;
+}
+
+bool DStarLite::setStart(int x, int y) {
+    if (!isReady() || !map.inside(x, y) || map.at(x, y) == WALL) return false;
+    startId = map.id(x, y);
+    return true;
+}
+
+int DStarLite::distance() const {
+    if (startId < 0 || map[startId] == WALL || g[startId] == INF) return -1;
+    return g[startId];
+}
+
+bool DStarLite::plan(vector<pair<int, int>>& path, DStarStats* st) {
+    DStarStats local;
+    DStarStats& s = st ? *st : local;
+    s = DStarStats();
+    path.clear();
+    if (!isReady()) return false;
+    auto t0 = chrono::steady_clock::now();
+    if (map[startId] != WALL) {
+        while (!open.empty()) {
+            OpenEntry top = open.top();
+            if (!keyLess(top, calcKey(startId)) && rhs[startId] == g[startId]) break;
+            int u = top.id;
+            OpenEntry kNew = calcKey(u);
+            s.expanded++;
+            if (keyLess(top, kNew)) {
+                open.update(kNew);
+            }else if (g[u] > rhs[u]) {
+                g[u] = rhs[u];
+                open.remove(u);
+                for (int i = 0; i < 4; i++)
+                    if (map[u + off[i]] != WALL) updateVertex(u + off[i]);
+            }else {
+                g[u] = INF;
+                updateVertex(u);
+                for (int i = 0; i < 4; i++)
+                    if (map[u + off[i]] != WALL) updateVertex(u + off[i]);
+            }
+        }
+    }
+    s.updated = pendingUpdates;
+    pendingUpdates = 0;
+    bool found = map[startId] != WALL && g[startId] != INF;
+    // 沿 g 值下降取路径
+    for (int cur = startId; found; ) {
+        path.push_back({ map.toX(cur), map.toY(cur) });
+        if (cur == goalId) break;
+        int next = -1;
+        for (int i = 0; i < 4; i++) {
+            int nid = cur + off[i];
+            if (map[nid] != WALL && g[nid] != INF && (next < 0 || g[nid] < g[next])) next = nid;
+        }
+        if (next < 0 || g[next] >= g[cur] || (int)path.size() > map.size()) { found = false; path.clear(); }
+        cur = next;
+    }
+    s.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    return found;
+}
@@ -0,0 +1,50 @@
+﻿#pragma once
+// 增量重规划（D* Lite，Koenig & Likhachev）：从终点反向维护 g / rhs，
+// 地图格子开关或起点移动后只修复受影响的部分，不重新整图搜索
+#include "MazeCore.h"
+#include <vector>
+#include <utility>
+
+struct DStarStats {
+    int expanded = 0;       // 本次 plan 出队处理的格子数
+    int updated = 0;        // 本次 plan 重新计算 rhs 的格子数（含改图时的更新）
+    double ms = 0;
+};
+
+class DStarLite {
+private:
+    MazeGrid map;
+    int off[4] = { 0, 0, 0, 0 };
+    int startId = -1, goalId = -1;
+    int lastId = -1;                // 上次计算 km 时的起点
+    int km = 0;                     // 起点移动累计的启发式修正
+    std::vector<int> g, rhs;
+    IndexedHeap open;               // 键 (k1, k2) 存为 (f = k1, g = -k2)，与堆的比较规则一致
+    int pendingUpdates = 0;
+
+    int h(int a, int b) const { return abs(map.toX(a) - map.toX(b)) + abs(map.toY(a) - map.toY(b)); }
+    OpenEntry calcKey(int id) const;
+    void updateVertex(int id);
+
+public:
+    DStarLite() {}
+    DStarLite(const DStarLite&) = delete;
+    DStarLite& operator=(const DStarLite&) = delete;
+
+    // 复制地图与起终点，清空搜索状态（第一次 plan 相当于一次完整的反向 A*）
+    void setMaze(const MazeData& m);
+    bool isReady() const { return startId >= 0; }
+    const MazeGrid& grid() const { return map; }
+
+    // 修改格子（0 墙 / 1 通路），只把该格与四邻重新入队；值未变或越界返回 false
+    bool setCell(int x, int y, uint8_t v);
+    bool toggleCell(int x, int y) { return map.inside(x, y) && setCell(x, y, map.at(x, y) == WALL ? 1 : 0); }
+    // 移动起点（沿已有路径前进时使用），搜索状态保留
+    bool setStart(int x, int y);
+
+    // 修复搜索并取出当前最短路径（起点到终点）；不可达返回 false
+    bool plan(std::vector<std::pair<int, int>>& path, DStarStats* st = nullptr);
+    // 上次 plan 后的起点距离；不可达（或起点在墙上）返回 -1
+    int distance() const;
+    size_t scratchBytes() const { return (g.size() + rhs.size()) * sizeof(int) + (size_t)map.size() * (sizeof(int) + sizeof(OpenEntry)); }
+};
@@ -0,0 +1,45 @@
+// 死胡同填充：完美迷宫填完后只剩起点到终点的那条走廊
+#include "MazeCore.h"
+#include <chrono>
+
+using namespace std;
+
+DeadEndStats MazeSolverCore::fillDeadEnds() {
+    DeadEndStats st;
+    if (!isReady()) return st;
+    auto t0 = chrono::steady_clock::now();
+    workMap.assign(maze.map);
+    // 每格的通路邻居数；度 <= 1 的格子即死胡同
+    vector<uint8_t>& deg = deadEndDeg;
+    deg.assign(maze.map.size(), 0);
+    const uint8_t* g = maze.map.data();
+    for (int x = 0; x < maze.rows; x++) {
+        int c = maze.map.id(x, 0);
+        for (int y = 0; y < maze.cols; y++, c++) {
+            if (g[c] == WALL) continue;
+            st.roadCells++;
+            deg[c] = (uint8_t)((g[c + off[0]] != WALL) + (g[c + off[1]] != WALL) + (g[c + off[2]] != WALL) + (g[c + off[3]] != WALL));
+        }
+    }
+    // 填掉一格只会让它唯一的邻居度减一，因此队列里至多一个格子，直接沿走廊追下去
+    for (int x = 0; x < maze.rows; x++) {
+        int c0 = maze.map.id(x, 0);
+        for (int y = 0; y < maze.cols; y++) {
+            int c = c0 + y;
+            while (deg[c] <= 1 && g[c] != WALL && workMap[c] != WALL && c != startId && c != endId) {
+                workMap.setWall(c);
+                st.filledCells++;
+                int next = -1;
+                for (int i = 0; i < 4; i++) {
+                    int nid = c + off[i];
+                    if (workMap[nid] != WALL) { next = nid; break; }
+                }
+                if (next < 0) break;
+                deg[next]--;
+                c = next;
+            }
+        }
+    }
+    st.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    return st;
+}
@@ -0,0 +1,72 @@
+// 终点距离场：同一终点的大量查询只做一次反向 BFS，缓存按地图内容哈希区分
+#include "MazeCore.h"
+
+using namespace std;
+
+uint64_t hashMazeData(const MazeData& maze) {
+    uint64_t h = 1469598103934665603ull;
+    auto mix = [&](uint64_t v) { h = (h ^ v) * 1099511628211ull; };
+    mix((uint64_t)maze.rows);
+    mix((uint64_t)maze.cols);
+    mix((uint64_t)maze.endX);
+    mix((uint64_t)maze.endY);
+    const uint8_t* p = maze.map.data();
+    for (int i = 0; i < maze.map.size(); i++) mix(p[i]);
+    return h;
+}
+
+// 从终点反向 BFS，返回访问的格子数；地图只读，不占用工作地图。终点是墙时全部不可达
+int MazeSolverCore::buildDistField() {
+    distField.assign(maze.map.size(), -1);
+    vector<int>& q = frontierRev;
+    q.clear();
+    if (maze.map[endId] != WALL) {
+        q.push_back(endId);
+        distField[endId] = 0;
+    }
+    for (size_t head = 0; head < q.size(); head++) {
+        int cur = q[head];
+        int d = distField[cur] + 1;
+        for (int i = 0; i < 4; i++) {
+            int nid = cur + off[i];
+            if (maze.map[nid] != WALL && distField[nid] < 0) {
+                distField[nid] = d;
+                q.push_back(nid);
+            }
+        }
+    }
+    distKey = mazeKey;
+    distValid = true;
+    return (int)q.size();
+}
+
+int MazeSolverCore::distanceToEnd(int x, int y) {
+    if (!isReady() || !maze.map.inside(x, y)) return -1;
+    if (!distFieldCached()) buildDistField();
+    return distField[maze.map.id(x, y)];
+}
+
+SolveResult MazeSolverCore::solveDistField(SearchObserver* o) {
+    return solveDistField(maze.startX, maze.startY, o);
+}
+
+SolveResult MazeSolverCore::solveDistField(int sx, int sy, SearchObserver* o) {
+    if (!isReady() || !maze.map.inside(sx, sy)) return SolveResult();
+    begin(o);
+    if (!distFieldCached()) res.visitedCount = buildDistField();
+    int cur = maze.map.id(sx, sy);
+    if (maze.map[cur] == WALL || distField[cur] < 0) return res;
+    // 贪心下降：每步走到距离恰好少 1 的邻居，按右下左上的顺序取第一个
+    pathIds.clear();
+    pathIds.push_back(cur);
+    while (distField[cur] > 0) {
+        int d = distField[cur] - 1;
+        for (int i = 0; i < 4; i++) {
+            if (distField[cur + off[i]] == d) { cur += off[i]; break; }
+        }
+        pathIds.push_back(cur);
+    }
+    res.visitedCount += (int)pathIds.size();
+    emitPath();
+    return res;
+}
@@ -0,0 +1,349 @@
+// 迷宫生成：回溯 / Kruskal / Wilson / Eller / 并行分块，种子化快速随机数；Eller 可逐行流式写盘
+#include "MazeCore.h"
+#include "MazeRandom.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// 迷宫格 (i, j) 位于地图 (2i+1, 2j+1)，格子之间隔一格墙；偶数尺寸时最后一行 / 列整行是墙
+
+// 时钟种子，保证非 0
+static uint64_t clockSeed() {
+    uint64_t t = (uint64_t)chrono::high_resolution_clock::now().time_since_epoch().count();
+    return t ? t : 1;
+}
+
+// 偶数尺寸时最后一行 / 列不是格子，终点取最近的奇数坐标
+static int lastCell(int n) { return (n - 2) % 2 ? n - 2 : n - 3; }
+
+static const char* GEN_NAMES[] = { "backtrack", "kruskal", "wilson", "eller", "tiled" };
+
+bool parseGenAlgo(const string& name, MazeGenAlgo& algo) {
+    for (int i = 0; i < 5; i++) {
+        if (name == GEN_NAMES[i]) { algo = (MazeGenAlgo)i; return true; }
+    }
+    return false;
+}
+
+const char* genAlgoName(MazeGenAlgo algo) {
+    return (algo >= GEN_BACKTRACK && algo <= GEN_TILED) ? GEN_NAMES[algo] : "unknown";
+}
+
+// 迭代回溯：在地图奇数坐标 [x0, x1] x [y0, y1] 的格子范围内打通，从 (x0, y0) 出发。
+// 栈里只存格子编号，深度不超过格子数的 1/4，内存与网格本身同量级
+static void carveBacktrack(MazeGrid& map, int x0, int y0, int x1, int y1, MazeRng& rng, vector<int>& st) {
+    uint8_t* g = map.data();
+    const int stride = map.stride();
+    const int step[4] = { 2 * stride, 2, -2 * stride, -2 };     // 下 右 上 左
+    const int dx[4] = { 2, 0, -2, 0 };
+    const int dy[4] = { 0, 2, 0, -2 };
+    st.clear();
+    int cx = x0, cy = y0;       // 起点
+    int cur = map.id(cx, cy);
+    g[cur] = ROAD;
+    st.push_back(cur);
+    while (true) {
+        // 检查四周距离为 2 的位置是否为墙
+        int dirs[4], n = 0;
+        if (cx + 2 <= x1 && g[cur + step[0]] == WALL) dirs[n++] = 0;
+        if (cy + 2 <= y1 && g[cur + step[1]] == WALL) dirs[n++] = 1;
+        if (cx - 2 >= x0 && g[cur + step[2]] == WALL) dirs[n++] = 2;
+        if (cy - 2 >= y0 && g[cur + step[3]] == WALL) dirs[n++] = 3;
+        if (n > 0) {
+            int d = dirs[n == 1 ? 0 : rng.below(n)];
+            g[cur + step[d] / 2] = ROAD;    // 打通墙
+            cur += step[d];
+            g[cur] = ROAD;                  // 打通目标
+            cx += dx[d]; cy += dy[d];
+            st.push_back(cur);
+        }else {
+            st.pop_back();                  // 回溯
+            if (st.empty()) break;
+            cur = st.back();
+            cx = map.toX(cur); cy = map.toY(cur);
+        }
+    }
+}
+
+static void genBacktrack(MazeData& maze, MazeRng& rng) {
+    vector<int> st;
+    carveBacktrack(maze.map, 1, 1, lastCell(maze.rows), lastCell(maze.cols), rng, st);
+}
+
+// Kruskal：所有内墙随机排列，两侧不在同一集合就打通（并查集，按秩合并 + 路径减半）
+static void genKruskal(MazeData& maze, MazeRng& rng) {
+    int R = (maze.rows - 1) / 2, C = (maze.cols - 1) / 2;
+    for (int i = 0; i < R; i++)
+        for (int j = 0; j < C; j++) maze.map.at(2 * i + 1, 2 * j + 1) = ROAD;
+    // 墙编码为 格子 * 2 + 方向（0 右，1 下）
+    vector<uint32_t> walls;
+    walls.reserve((size_t)R * C * 2);
+    for (int i = 0; i < R; i++) {
+        for (int j = 0; j < C; j++) {
+            uint32_t c = (uint32_t)(i * C + j);
+            if (j + 1 < C) walls.push_back(c << 1);
+            if (i + 1 < R) walls.push_back(c << 1 | 1);
+        }
+    }
+    for (size_t k = walls.size(); k > 1; k--) swap(walls[k - 1], walls[rng.below((uint32_t)k)]);
+    vector<int> parent((size_t)R * C);
+    vector<uint8_t> rank((size_t)R * C, 0);
+    for (size_t k = 0; k < parent.size(); k++) parent[k] = (int)k;
+    auto find = [&](int v) {
+        while (parent[v] != v) { parent[v] = parent[parent[v]]; v = parent[v]; }
+        return v;
+    };
+    int joins = R * C - 1;
+    for (size_t k = 0; k < walls.size() && joins > 0; k++) {
+        int a = (int)(walls[k] >> 1);
+        bool down = walls[k] & 1;
+        int ra = find(a), rb = find(down ? a + C : a + 1);
+        if (ra == rb) continue;
+        if (rank[ra] > rank[rb]) swap(ra, rb);
+        parent[ra] = rb;
+        if (rank[ra] == rank[rb]) rank[rb]++;
+        joins--;
+        int i = a / C, j = a % C;
+        maze.map.at(2 * i + 1 + down, 2 * j + 1 + !down) = ROAD;
+    }
+}
+
+// Wilson：从不在树上的格子做随机游走，每格只记最后一次离开的方向（即擦除回路），
+// 碰到树后沿记录的方向把这条路径并入树；得到均匀分布的生成树
+static void genWilson(MazeData& maze, MazeRng& rng) {
+    int R = (maze.rows - 1) / 2, C = (maze.cols - 1) / 2;
+    uint8_t* g = maze.map.data();
+    const int stride = maze.map.stride();
+    const int step[4] = { 2 * stride, 2, -2 * stride, -2 };     // 下 右 上 左
+    const int di[4] = { 1, 0, -1, 0 };
+    const int dj[4] = { 0, 1, 0, -1 };
+    vector<uint8_t> exitDir((size_t)R * C);
+    uint32_t root = rng.below((uint32_t)R * C);
+    g[maze.map.id(2 * (root / C) + 1, 2 * (root % C) + 1)] = ROAD;   // 地图上为通路即在树上
+    for (int si = 0; si < R; si++) {
+        for (int sj = 0; sj < C; sj++) {
+            int sid = maze.map.id(2 * si + 1, 2 * sj + 1);
+            if (g[sid] == ROAD) continue;
+            // 随机游走直到碰到树
+            int i = si, j = sj, cur = sid;
+            while (g[cur] != ROAD) {
+                int d;
+                do { d = (int)rng.below(4); } while (i + di[d] < 0 || i + di[d] >= R || j + dj[d] < 0 || j + dj[d] >= C);
+                exitDir[(size_t)i * C + j] = (uint8_t)d;
+                i += di[d]; j += dj[d];
+                cur += step[d];
+            }
+            // 沿最后的离开方向并入树
+            i = si; j = sj; cur = sid;
+            while (g[cur] != ROAD) {
+                int d = exitDir[(size_t)i * C + j];
+                g[cur] = ROAD;
+                g[cur + step[d] / 2] = ROAD;
+                i += di[d]; j += dj[d];
+                cur += step[d];
+            }
+        }
+    }
+}
+
+// Eller：逐行维护每列所属集合。行内随机合并相邻的不同集合（最后一行全部合并），
+// 每个集合至少向下打通一格，向下的格子把集合带到下一行。每产生一行地图就交给 emit
+template <class Emit>
+static void runEller(int rows, int cols, MazeRng& rng, Emit emit) {
+    int R = (rows - 1) / 2, C = (cols - 1) / 2;
+    vector<uint8_t> line(cols, WALL), below(cols, WALL);
+    vector<int> label(C, -1), parent(C), count(C), remap(C, -1);
+    vector<uint8_t> hasDown(C);
+    uint64_t bits = 0;
+    int bitsLeft = 0;
+    auto coin = [&]() {
+        if (bitsLeft == 0) { bits = rng.next(); bitsLeft = 64; }
+        bitsLeft--;
+        bool b = bits & 1;
+        bits >>= 1;
+        return b;
+    };
+    auto find = [&](int v) {
+        while (parent[v] != v) { parent[v] = parent[parent[v]]; v = parent[v]; }
+        return v;
+    };
+    int emitted = 0;
+    emit(line.data());          // 顶部围墙
+    emitted++;
+    for (int r = 0; r < R; r++) {
+        bool last = r == R - 1;
+        // 上一行带下来的集合已压缩为 0..used-1，其余格子分配新集合
+        int used = 0;
+        for (int j = 0; j < C; j++) used = max(used, label[j] + 1);
+        for (int j = 0; j < C; j++) if (label[j] < 0) label[j] = used++;
+        for (int l = 0; l < used; l++) { parent[l] = l; count[l] = 0; hasDown[l] = 0; }
+        fill(line.begin(), line.end(), (uint8_t)WALL);
+        for (int j = 0; j < C; j++) {
+            line[2 * j + 1] = ROAD;
+            if (j + 1 == C) break;
+            int a = find(label[j]), b = find(label[j + 1]);
+            if (a != b && (last || coin())) {
+                parent[a] = b;
+                line[2 * j + 2] = ROAD;
+            }
+        }
+        emit(line.data());
+        emitted++;
+        fill(below.begin(), below.end(), (uint8_t)WALL);
+        if (last) break;
+        for (int j = 0; j < C; j++) { label[j] = find(label[j]); count[label[j]]++; }
+        // 每个集合随机向下，最后一个成员仍未向下时强制向下；下一行的集合编号重新压缩
+        int next = 0;
+        for (int j = 0; j < C; j++) {
+            int s = label[j];
+            bool down = coin();
+            if (--count[s] == 0 && !hasDown[s]) down = true;
+            if (down) {
+                hasDown[s] = 1;
+                below[2 * j + 1] = ROAD;
+                if (remap[s] < 0) remap[s] = next++;
+                label[j] = remap[s];
+            }else label[j] = -1;
+        }
+        for (int l = 0; l < used; l++) remap[l] = -1;
+        emit(below.data());
+        emitted++;
+    }
+    // 底部围墙（偶数行数时再多一行）
+    for (; emitted < rows; emitted++) emit(below.data());
+}
+
+// 分块生成：每块以 (种子, 块编号) 派生的独立随机数在块内回溯，块之间互不相交可并行；
+// 再按主种子在块的邻接图上随机取一棵生成树，每条树边在公共边界上随机打通一格。
+// 块内是树、块间也是树，整体仍是完美迷宫，任意两格连通；结果与线程数无关
+void generateTiledMaze(MazeData& maze, int rows, int cols, uint64_t seed, int threads, int tileCells) {
+    if (rows < 3) rows = 3;
+    if (cols < 3) cols = 3;
+    if (seed == 0) seed = clockSeed();
+    if (tileCells < 1) tileCells = 1;
+    maze.rows = rows; maze.cols = cols;
+    maze.seed = seed;
+    maze.map.assign(rows, cols, WALL);
+    int R = (rows - 1) / 2, C = (cols - 1) / 2;
+    int tr = (R + tileCells - 1) / tileCells, tc = (C + tileCells - 1) / tileCells;
+    ThreadPool pool(threads < 1 ? 1 : threads);
+    vector<vector<int>> stacks(pool.size());
+    atomic<int> next(0);
+    // 各线程领取块号；块的结果只取决于块号，与哪个线程执行无关
+    pool.run(pool.size(), [&](int w) {
+        for (int t = next++; t < tr * tc; t = next++) {
+            int ti = t / tc, tj = t % tc;
+            int i0 = ti * tileCells, j0 = tj * tileCells;
+            int i1 = min(R, i0 + tileCells) - 1, j1 = min(C, j0 + tileCells) - 1;
+            MazeRng rng(seed ^ (0x9e3779b97f4a7c15ull * (uint64_t)(t + 1)));
+            carveBacktrack(maze.map, 2 * i0 + 1, 2 * j0 + 1, 2 * i1 + 1, 2 * j1 + 1, rng, stacks[w]);
+        }
+    });
+    // 块间生成树：块邻接边随机排列后做 Kruskal
+    MazeRng rng(seed);
+    vector<uint32_t> edges;
+    for (int t = 0; t < tr * tc; t++) {
+        if (t % tc + 1 < tc) edges.push_back((uint32_t)t << 1);
+        if (t / tc + 1 < tr) edges.push_back((uint32_t)t << 1 | 1);
+    }
+    for (size_t k = edges.size(); k > 1; k--) swap(edges[k - 1], edges[rng.below((uint32_t)k)]);
+    vector<int> parent(tr * tc);
+    for (int t = 0; t < tr * tc; t++) parent[t] = t;
+    auto find = [&](int v) {
+        while (parent[v] != v) { parent[v] = parent[parent[v]]; v = parent[v]; }
+        return v;
+    };
+    for (uint32_t e : edges) {
+        int a = (int)(e >> 1);
+        bool down = e & 1;
+        int ra = find(a), rb = find(down ? a + tc : a + 1);
+        if (ra == rb) continue;
+        parent[ra] = rb;
+        int ti = a / tc, tj = a % tc;
+        if (down) {
+            // 块 a 最后一行格子与下方块第一行格子之间的墙
+            int j0 = tj * tileCells, span = min(C, j0 + tileCells) - j0;
+            int j = j0 + (int)rng.below((uint32_t)span);
+            maze.map.at(2 * (ti + 1) * tileCells, 2 * j + 1) = ROAD;
+        }else {
+            int i0 = ti * tileCells, span = min(R, i0 + tileCells) - i0;
+            int i = i0 + (int)rng.below((uint32_t)span);
+            maze.map.at(2 * i + 1, 2 * (tj + 1) * tileCells) = ROAD;
+        }
+    }
+    maze.startX = 1; maze.startY = 1;
+    maze.endX = lastCell(rows);
+    maze.endY = lastCell(cols);
+}
+
+void generateMazeData(MazeData& maze, int rows, int cols, uint64_t seed, MazeGenAlgo algo) {
+    if (algo == GEN_TILED) {
+        generateTiledMaze(maze, rows, cols, seed, (int)thread::hardware_concurrency());
+        return;
+    }
+    if (rows < 3) rows = 3;
+    if (cols < 3) cols = 3;
+    if (seed == 0) seed = clockSeed();
+    maze.rows = rows; maze.cols = cols;
+    maze.seed = seed;
+    maze.map.assign(rows, cols, WALL);
+    MazeRng rng(seed);
+    if (algo == GEN_KRUSKAL) genKruskal(maze, rng);
+    else if (algo == GEN_WILSON) genWilson(maze, rng);
+    else if (algo == GEN_ELLER) {
+        int x = 0;
+        runEller(rows, cols, rng, [&](const uint8_t* row) { memcpy(&maze.map.at(x++, 0), row, cols); });
+    }
+    else genBacktrack(maze, rng);
+    maze.startX = 1; maze.startY = 1;
+    maze.endX = lastCell(rows);
+    maze.endY = lastCell(cols);
+}
+
+// 一行地图转成 "| . . |" 形式
+static void formatRow(const uint8_t* row, int cols, string& out) {
+    out.resize((size_t)cols * 2);
+    for (int j = 0; j < cols; j++) {
+        out[2 * j] = row[j] == WALL ? '|' : '.';
+        out[2 * j + 1] = ' ';
+    }
+    out[2 * cols - 1] = '\n';
+}
+
+bool saveMazeFile(const string& fname, const MazeData& maze, string& err) {
+    ofstream out(fname, ios::binary);
+    if (!out.is_open()) { err = "无法写入文件: " + fname; return false; }
+    out << maze.rows << " " << maze.cols << "\n";
+    string line;
+    for (int i = 0; i < maze.rows; i++) {
+        formatRow(maze.map.data() + maze.map.id(i, 0), maze.cols, line);
+        out.write(line.data(), (streamsize)line.size());
+    }
+    out << maze.startX << " " << maze.startY << "\n" << maze.endX << " " << maze.endY << "\n";
+    if (!out) { err = "写入失败: " + fname; return false; }
+    return true;
+}
+
+bool streamEllerMaze(const string& fname, int rows, int cols, uint64_t& seed, string& err) {
+    if (rows < 3) rows = 3;
+    if (cols < 3) cols = 3;
+    if (seed == 0) seed = clockSeed();
+    ofstream out(fname, ios::binary);
+    if (!out.is_open()) { err = "无法写入文件: " + fname; return false; }
+    out << rows << " " << cols << "\n";
+    MazeRng rng(seed);
+    string line;
+    runEller(rows, cols, rng, [&](const uint8_t* row) {
+        formatRow(row, cols, line);
+        out.write(line.data(), (streamsize)line.size());
+    });
+    out << 1 << " " << 1 << "\n" << lastCell(rows) << " " << lastCell(cols) << "\n";
+    if (!out) { err = "写入失败: " + fname; return false; }
+    return true;
+}
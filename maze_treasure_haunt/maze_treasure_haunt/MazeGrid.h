@@ -0,0 +1,132 @@
+﻿#pragma once
+// 连续行主序网格：每格 1 字节，外围一圈墙做哨兵，邻居探测无需越界判断
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class MazeGrid {
+private:
+    std::vector<uint8_t> cells;
+    int nRows = 0, nCols = 0;
+    int nStride = 0;            // 含哨兵的行宽 = cols + 2
+
+public:
+    static const int PAD = 1;   // 哨兵墙宽度
+
+    MazeGrid() {}
+    MazeGrid(int rows, int cols, uint8_t v) { assign(rows, cols, v); }
+
+    // 重新分配，哨兵墙固定为 0（WALL）
+    void assign(int rows, int cols, uint8_t v) {
+        nRows = rows; nCols = cols; nStride = cols + 2 * PAD;
+        cells.assign((size_t)(rows + 2 * PAD) * nStride, 0);
+        for (int i = 0; i < rows; i++) {
+            uint8_t* row = &cells[(size_t)(i + PAD) * nStride + PAD];
+            for (int j = 0; j < cols; j++) row[j] = v;
+        }
+    }
+
+    bool empty() const { return nRows == 0 || nCols == 0; }
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    int stride() const { return nStride; }
+    int size() const { return (int)cells.size(); }   // 含哨兵的格子总数
+
+    // 坐标与格子编号互转（x 为行，y 为列）
+    int id(int x, int y) const { return (x + PAD) * nStride + (y + PAD); }
+    int toX(int id) const { return id / nStride - PAD; }
+    int toY(int id) const { return id % nStride - PAD; }
+    bool inside(int x, int y) const { return x >= 0 && x < nRows && y >= 0 && y < nCols; }
+
+    uint8_t& at(int x, int y) { return cells[id(x, y)]; }
+    uint8_t at(int x, int y) const { return cells[id(x, y)]; }
+    uint8_t& operator[](int id) { return cells[id]; }
+    uint8_t operator[](int id) const { return cells[id]; }
+    uint8_t* data() { return cells.data(); }
+    const uint8_t* data() const { return cells.data(); }
+
+    // 四邻居编号偏移，与 dx/dy 顺序一致：右 下 左 上
+    void neighborOffsets(int off[4]) const {
+        off[0] = 1; off[1] = nStride; off[2] = -1; off[3] = -nStride;
+    }
+};
+
+// 前驱方向表：每格 2 bit，记录从父格子走到该格子的方向（0..3，与 dx/dy 一致）
+// 父格子编号 = 当前编号 - off[dir]，路径回溯无需节点对象
+class ParentDirs {
+private:
+    std::vector<uint8_t> bits;
+
+public:
+    void resize(int cellCount) { bits.assign(((size_t)cellCount + 3) / 4, 0); }
+    void set(int id, int dir) {
+        uint8_t& b = bits[(size_t)id >> 2];
+        int sh = (id & 3) * 2;
+        b = (uint8_t)((b & ~(3 << sh)) | (dir << sh));
+    }
+    int get(int id) const { return (bits[(size_t)id >> 2] >> ((id & 3) * 2)) & 3; }
+    size_t bytes() const { return bits.size(); }
+};
+
+// 按代数戳记的工作地图：每格 16 位 = 代数 << 3 | 状态，墙为固定值。
+// nextEpoch() 只把代数加一，上次搜索写下的标记整体失效；
+// 代数每 8000 余次搜索回绕一次才整表清零，均摊下来重置为 O(1)
+class EpochGrid {
+private:
+    std::vector<uint16_t> cells;
+    uint16_t epoch = 1;
+    static const uint16_t WALL_MARK = 0xffff;
+
+public:
+    // 按原始地图初始化：墙格固定，其余为未访问
+    void assign(const MazeGrid& g) {
+        cells.resize(g.size());
+        for (int i = 0; i < g.size(); i++) cells[i] = g[i] == 0 ? WALL_MARK : 0;
+        epoch = 1;
+    }
+
+    void nextEpoch() {
+        if (++epoch >= (WALL_MARK >> 3)) {     // 代数回绕时才真正清零
+            for (uint16_t& c : cells) if (c != WALL_MARK) c = 0;
+            epoch = 1;
+        }
+    }
+
+    int size() const { return (int)cells.size(); }
+    size_t bytes() const { return cells.size() * sizeof(uint16_t); }
+
+    // 取值与 MazeGrid 一致：0 墙，1 通路，其余为本次搜索写入的状态
+    uint8_t operator[](int id) const {
+        uint16_t c = cells[id];
+        if (c == WALL_MARK) return 0;
+        return (c >> 3) == epoch ? (uint8_t)(c & 7) : 1;
+    }
+    void set(int id, uint8_t v) { cells[id] = (uint16_t)((epoch << 3) | v); }
+    void setWall(int id) { cells[id] = WALL_MARK; }     // 永久设为墙，不随代数失效
+};
+
+// 按代数戳记的整数表：本代未写入的格子读作默认值，重置为 O(1)
+class EpochTable {
+private:
+    struct Slot { int val; uint32_t stamp; };
+    std::vector<Slot> slots;
+    uint32_t epoch = 1;
+    int def = 0;
+
+public:
+    int size() const { return (int)slots.size(); }
+    void resize(int cellCount, int defVal) {
+        slots.assign(cellCount, Slot{ defVal, 0 });
+        epoch = 1;
+        def = defVal;
+    }
+    void nextEpoch() {
+        if (++epoch == 0) {
+            for (Slot& s : slots) s.stamp = 0;
+            epoch = 1;
+        }
+    }
+    int operator[](int id) const { const Slot& s = slots[id]; return s.stamp == epoch ? s.val : def; }
+    void set(int id, int v) { slots[id] = Slot{ v, epoch }; }
+    size_t bytes() const { return slots.size() * sizeof(Slot); }
+};
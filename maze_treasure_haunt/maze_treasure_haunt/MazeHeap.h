@@ -0,0 +1,157 @@
+﻿#pragma once
+// A* 开放表：索引 4 叉堆（支持 decrease-key）与单调桶队列（Dial）
+#include <vector>
+
+// 开放表条目：只存格子编号和代价，前驱记录在 ParentDirs 中
+struct OpenEntry {
+    int f, g, id;
+    unsigned seq = 0;   // 入堆序号，由 IndexedHeap 填写
+    // f 小者优先；f 相同时 g 大者优先（更靠近终点）；再相同时后入堆者优先
+    bool betterThan(const OpenEntry& other) const {
+        if (f != other.f) return f < other.f;
+        if (g != other.g) return g > other.g;
+        return seq > other.seq;
+    }
+};
+
+class IndexedHeap {
+private:
+    std::vector<OpenEntry> heap;
+    std::vector<int> pos;       // 格子编号 -> 堆下标，-1 表示不在堆中
+    unsigned counter = 0;
+
+    static const int ARITY = 4;
+
+    void place(int i, const OpenEntry& e) { heap[i] = e; pos[e.id] = i; }
+
+    void siftUp(int i) {
+        OpenEntry e = heap[i];
+        while (i > 0) {
+            int p = (i - 1) / ARITY;
+            if (!e.betterThan(heap[p])) break;
+            place(i, heap[p]);
+            i = p;
+        }
+        place(i, e);
+    }
+
+    void siftDown(int i) {
+        OpenEntry e = heap[i];
+        int n = (int)heap.size();
+        while (true) {
+            int first = i * ARITY + 1;
+            if (first >= n) break;
+            int best = first;
+            int last = first + ARITY < n ? first + ARITY : n;
+            for (int c = first + 1; c < last; c++)
+                if (heap[c].betterThan(heap[best])) best = c;
+            if (!heap[best].betterThan(e)) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, e);
+    }
+
+public:
+    // 按地图格子数准备位置表
+    void resize(int cellCount) { pos.assign(cellCount, -1); heap.clear(); }
+
+    // 清空堆，只复位仍在堆中的格子
+    void clear() {
+        for (const OpenEntry& e : heap) pos[e.id] = -1;
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    int size() const { return (int)heap.size(); }
+    bool contains(int id) const { return pos[id] >= 0; }
+    const OpenEntry& top() const { return heap[0]; }
+
+    void push(OpenEntry e) {
+        e.seq = ++counter;
+        heap.push_back(e);
+        pos[e.id] = (int)heap.size() - 1;
+        siftUp((int)heap.size() - 1);
+    }
+
+    // 已在堆中的格子改为更优的代价
+    void decrease(OpenEntry e) {
+        e.seq = ++counter;
+        int i = pos[e.id];
+        heap[i] = e;
+        siftUp(i);
+    }
+
+    // 已在堆中的格子改为任意新代价（可变大，供增量搜索使用）
+    void update(OpenEntry e) {
+        e.seq = ++counter;
+        int i = pos[e.id];
+        heap[i] = e;
+        siftUp(i);
+        siftDown(pos[e.id]);
+    }
+
+    // 把格子移出堆
+    void remove(int id) {
+        int i = pos[id];
+        pos[id] = -1;
+        OpenEntry last = heap.back();
+        heap.pop_back();
+        if (i < (int)heap.size()) {
+            place(i, last);
+            siftUp(i);
+            siftDown(pos[last.id]);
+        }
+    }
+
+    OpenEntry pop() {
+        OpenEntry top = heap[0];
+        pos[top.id] = -1;
+        OpenEntry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+// 单调桶队列（Dial）：按 f 分桶，适用于单位代价网格 + 一致启发式（出队 f 单调不减）
+// push/pop 均摊 O(1)；不支持原地 decrease-key，更新时直接再入队，由调用方跳过过期条目
+class BucketQueue {
+private:
+    std::vector<std::vector<OpenEntry>> buckets;
+    int base = 0;               // buckets[0] 对应的 f 值
+    int cur = 0;                // 当前最小非空桶下标
+    int count = 0;
+
+public:
+    // 清空并以 f0 作为最小键
+    void clear(int f0 = 0) {
+        for (auto& b : buckets) b.clear();
+        base = f0; cur = 0; count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+
+    void push(const OpenEntry& e) {
+        int idx = e.f - base;
+        if (idx >= (int)buckets.size()) buckets.resize(idx + 1);
+        buckets[idx].push_back(e);   // 桶内后进先出：同 f 时新扩展（g 较大）的先出
+        if (idx < cur) cur = idx;
+        count++;
+    }
+
+    // 与 IndexedHeap 接口一致，再入队即可
+    void decrease(const OpenEntry& e) { push(e); }
+
+    OpenEntry pop() {
+        while (buckets[cur].empty()) cur++;
+        OpenEntry e = buckets[cur].back();
+        buckets[cur].pop_back();
+        count--;
+        return e;
+    }
+};
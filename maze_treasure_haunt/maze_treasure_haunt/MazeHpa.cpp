@@ -0,0 +1,246 @@
+// HPA*：抽象建立、按簇重建、查询与细化
+#include "MazeHpa.h"
+#include "MazeCore.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+static const int HPA_RUN_SPLIT = 6;     // 入口段长度达到此值时在两端各取一个入口，否则取中点
+
+void HpaGraph::build(const MazeGrid& m, int clusterSize) {
+    map = m;
+    map.neighborOffsets(off);
+    cs = clusterSize < 2 ? 2 : clusterSize;
+    cRows = (map.rows() + cs - 1) / cs;
+    cCols = (map.cols() + cs - 1) / cs;
+    clusters.assign(cRows * cCols, Cluster());
+    for (int i = 0; i < cRows; i++) {
+        for (int j = 0; j < cCols; j++) {
+            Cluster& c = clusters[i * cCols + j];
+            c.x0 = i * cs; c.y0 = j * cs;
+            c.h = min(cs, map.rows() - c.x0);
+            c.w = min(cs, map.cols() - c.y0);
+        }
+    }
+    rightBorder.assign(clusters.size(), Border());
+    downBorder.assign(clusters.size(), Border());
+    nodeLocal.assign(map.size(), -1);
+    localDist.assign(cs * cs, -1);
+    localParent.assign(cs * cs, -1);
+    localQueue.reserve(cs * cs);
+    for (int k = 0; k < (int)clusters.size(); k++) { scanBorder(k, true); scanBorder(k, false); }
+    for (int k = 0; k < (int)clusters.size(); k++) rebuildNodes(k);
+    gCell.resize(map.size(), INT_MAX);
+    parentCell.resize(map.size(), -1);
+    closedCell.resize(map.size(), 0);
+    open.resize(map.size());
+}
+
+// 扫描簇 a 的右边界（right）或下边界，两侧同时为通路的连续段即一个入口段
+void HpaGraph::scanBorder(int a, bool right) {
+    Border& b = right ? rightBorder[a] : downBorder[a];
+    b.clear();
+    const Cluster& c = clusters[a];
+    if (right ? (c.y0 + c.w >= map.cols()) : (c.x0 + c.h >= map.rows())) return;
+    int len = right ? c.h : c.w;
+    auto cellA = [&](int t) { return right ? map.id(c.x0 + t, c.y0 + c.w - 1) : map.id(c.x0 + c.h - 1, c.y0 + t); };
+    int step = right ? off[0] : off[1];
+    auto add = [&](int t) { b.push_back({ cellA(t), cellA(t) + step }); };
+    int start = -1;
+    for (int t = 0; t <= len; t++) {
+        bool openPair = t < len && map[cellA(t)] != WALL && map[cellA(t) + step] != WALL;
+        if (openPair && start < 0) start = t;
+        if (!openPair && start >= 0) {
+            int runLen = t - start;
+            if (runLen < HPA_RUN_SPLIT) add(start + runLen / 2);
+            else { add(start); add(t - 1); }
+            start = -1;
+        }
+    }
+}
+
+// 由四条边界重新收集簇 k 的入口，并对每个入口做簇内 BFS 得到距离表
+void HpaGraph::rebuildNodes(int k) {
+    Cluster& c = clusters[k];
+    for (int id : c.nodes) nodeLocal[id] = -1;
+    c.nodes.clear();
+    c.links.clear();
+    int ci = k / cCols, cj = k % cCols;
+    auto addNode = [&](int id, int partner) {
+        if (nodeLocal[id] < 0) {
+            nodeLocal[id] = (int)c.nodes.size();
+            c.nodes.push_back(id);
+            c.links.push_back(vector<int>());
+        }
+        c.links[nodeLocal[id]].push_back(partner);
+    };
+    for (auto& p : rightBorder[k]) addNode(p.first, p.second);
+    for (auto& p : downBorder[k]) addNode(p.first, p.second);
+    if (cj > 0) for (auto& p : rightBorder[k - 1]) addNode(p.second, p.first);
+    if (ci > 0) for (auto& p : downBorder[k - cCols]) addNode(p.second, p.first);
+    int n = (int)c.nodes.size();
+    c.dist.assign(n * n, -1);
+    for (int a = 0; a < n; a++) {
+        clusterBfs(c, c.nodes[a], false);
+        for (int b = 0; b < n; b++) c.dist[a * n + b] = localDist[localIndex(c, c.nodes[b])];
+    }
+}
+
+// 限制在簇内的 BFS，结果写入 localDist（簇内局部下标），返回访问的格子数；
+// 给定 target 时（细化用）到达即停止
+int HpaGraph::clusterBfs(const Cluster& c, int src, bool keepParent, int target) {
+    fill(localDist.begin(), localDist.begin() + c.h * c.w, -1);
+    localQueue.clear();
+    localQueue.push_back(src);
+    localDist[localIndex(c, src)] = 0;
+    if (keepParent) localParent[localIndex(c, src)] = -1;
+    for (size_t head = 0; head < localQueue.size(); head++) {
+        int cur = localQueue[head];
+        if (cur == target) return (int)head + 1;
+        int d = localDist[localIndex(c, cur)] + 1;
+        int x = map.toX(cur), y = map.toY(cur);
+        for (int i = 0; i < 4; i++) {
+            int nid = cur + off[i];
+            if (map[nid] == WALL) continue;
+            int nx = x + (i == 1) - (i == 3), ny = y + (i == 0) - (i == 2);
+            if (nx < c.x0 || nx >= c.x0 + c.h || ny < c.y0 || ny >= c.y0 + c.w) continue;
+            int li = localIndex(c, nid);
+            if (localDist[li] >= 0) continue;
+            localDist[li] = d;
+            if (keepParent) localParent[li] = cur;
+            localQueue.push_back(nid);
+        }
+    }
+    return (int)localQueue.size();
+}
+
+void HpaGraph::setCell(int x, int y, uint8_t v) {
+    if (!map.inside(x, y) || map.at(x, y) == v) return;
+    map.at(x, y) = v;
+    int k = clusterOf(x, y);
+    int ci = k / cCols, cj = k % cCols;
+    scanBorder(k, true);
+    scanBorder(k, false);
+    if (cj > 0) scanBorder(k - 1, true);
+    if (ci > 0) scanBorder(k - cCols, false);
+    rebuildNodes(k);
+    if (cj > 0) rebuildNodes(k - 1);
+    if (cj + 1 < cCols) rebuildNodes(k + 1);
+    if (ci > 0) rebuildNodes(k - cCols);
+    if (ci + 1 < cRows) rebuildNodes(k + cCols);
+}
+
+int HpaGraph::nodeCount() const {
+    int n = 0;
+    for (auto& c : clusters) n += (int)c.nodes.size();
+    return n;
+}
+
+int HpaGraph::edgeCount() const {
+    int e = 0;
+    for (auto& c : clusters) {
+        for (int d : c.dist) e += d > 0;
+        for (auto& l : c.links) e += (int)l.size();
+    }
+    return e;
+}
+
+bool HpaGraph::findPath(int sx, int sy, int ex, int ey, vector<int>& pathIds, HpaQueryStats* st) {
+    HpaQueryStats local;
+    HpaQueryStats& s = st ? *st : local;
+    s = HpaQueryStats();
+    pathIds.clear();
+    if (map.empty() || !map.inside(sx, sy) || !map.inside(ex, ey)) return false;
+    int src = map.id(sx, sy), dst = map.id(ex, ey);
+    if (map[src] == WALL || map[dst] == WALL) return false;
+    if (src == dst) { pathIds.push_back(src); return true; }
+
+    // 临时接入起点与终点：各在本簇内 BFS 到簇内入口
+    int ks = clusterOf(sx, sy), kt = clusterOf(ex, ey);
+    const Cluster& cst = clusters[ks];
+    const Cluster& ctg = clusters[kt];
+    s.refineCells += clusterBfs(cst, src, false);
+    startLinks.clear();
+    for (int id : cst.nodes) {
+        int d = localDist[localIndex(cst, id)];
+        if (d > 0) startLinks.push_back({ id, d });
+    }
+    if (ks == kt && localDist[localIndex(cst, dst)] > 0) startLinks.push_back({ dst, localDist[localIndex(cst, dst)] });
+    s.refineCells += clusterBfs(ctg, dst, false);
+    goalDist.assign(ctg.nodes.size(), -1);
+    for (size_t a = 0; a < ctg.nodes.size(); a++) goalDist[a] = localDist[localIndex(ctg, ctg.nodes[a])];
+
+    // 抽象图 A*：节点以格子编号标识
+    gCell.nextEpoch();
+    parentCell.nextEpoch();
+    closedCell.nextEpoch();
+    open.clear();
+    auto h = [&](int id) { return abs(map.toX(id) - ex) + abs(map.toY(id) - ey); };
+    auto relax = [&](int from, int to, int g) {
+        if (closedCell[to]) return;
+        int old = gCell[to];
+        if (g >= old) return;
+        OpenEntry e = { g + h(to), g, to };
+        if (open.contains(to)) open.decrease(e);
+        else open.push(e);
+        gCell.set(to, g);
+        parentCell.set(to, from);
+    };
+    open.push({ h(src), 0, src });
+    gCell.set(src, 0);
+    bool found = false;
+    while (!open.empty()) {
+        OpenEntry cur = open.pop();
+        s.expanded++;
+        if (cur.id == dst) { found = true; break; }
+        closedCell.set(cur.id, 1);
+        if (cur.id == src)
+            for (auto& l : startLinks) relax(src, l.first, cur.g + l.second);
+        int a = nodeLocal[cur.id];
+        if (a < 0) continue;
+        int k = clusterOfId(cur.id);
+        const Cluster& c = clusters[k];
+        int n = (int)c.nodes.size();
+        for (int b = 0; b < n; b++) {
+            int d = c.dist[a * n + b];
+            if (d > 0) relax(cur.id, c.nodes[b], cur.g + d);
+        }
+        for (int p : c.links[a]) relax(cur.id, p, cur.g + 1);
+        if (k == kt && goalDist[a] > 0) relax(cur.id, dst, cur.g + goalDist[a]);
+    }
+    if (!found) return false;
+
+    // 细化：相邻的抽象节点直接相连，其余同簇的一段在簇内 BFS 还原
+    vector<int> chain;
+    for (int v = dst; v != src; v = parentCell[v]) chain.push_back(v);
+    chain.push_back(src);
+    reverse(chain.begin(), chain.end());
+    pathIds.push_back(src);
+    for (size_t i = 1; i < chain.size(); i++) {
+        int p = chain[i - 1], q = chain[i];
+        if (abs(map.toX(p) - map.toX(q)) + abs(map.toY(p) - map.toY(q)) == 1) { pathIds.push_back(q); continue; }
+        const Cluster& c = clusters[clusterOfId(p)];
+        s.refineCells += clusterBfs(c, p, true, q);
+        size_t mark = pathIds.size();
+        for (int v = q; v != p; v = localParent[localIndex(c, v)]) pathIds.push_back(v);
+        reverse(pathIds.begin() + mark, pathIds.end());
+    }
+    return true;
+}
+
+SolveResult MazeSolverCore::solveHPA(SearchObserver* o) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!hpaValid || hpaKey != mazeKey) {
+        hpa.build(maze.map);
+        hpaKey = mazeKey;
+        hpaValid = true;
+    }
+    HpaQueryStats st;
+    bool found = hpa.findPath(maze.startX, maze.startY, maze.endX, maze.endY, pathIds, &st);
+    res.visitedCount = st.expanded;
+    if (obs) obs->onStats(res.visitedCount, 0);
+    if (found) emitPath();
+    return res;
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+// HPA*：按固定大小分簇，簇边界上取入口，预先算好簇内入口之间的距离；
+// 查询时在抽象图上做 A*，再逐段在簇内细化成格子路径
+#include "MazeGrid.h"
+#include "MazeHeap.h"
+#include <vector>
+
+struct HpaQueryStats {
+    int expanded = 0;       // 抽象图上扩展的节点数
+    int refineCells = 0;    // 细化时簇内 BFS 访问的格子数
+};
+
+class HpaGraph {
+public:
+    // 复制地图并建立全部簇的抽象
+    void build(const MazeGrid& map, int clusterSize = 32);
+    // 修改一个格子（0 墙 / 1 通路），只重建它所在的簇及四邻簇
+    void setCell(int x, int y, uint8_t v);
+
+    // 查询 (sx,sy) -> (ex,ey)，pathIds 为格子编号（与原地图编号一致），起点到终点
+    bool findPath(int sx, int sy, int ex, int ey, std::vector<int>& pathIds, HpaQueryStats* st = nullptr);
+
+    bool empty() const { return map.empty(); }
+    const MazeGrid& grid() const { return map; }
+    int clusterSize() const { return cs; }
+    int clusterCount() const { return (int)clusters.size(); }
+    int nodeCount() const;
+    int edgeCount() const;      // 簇内边 + 簇间边（有向）
+
+private:
+    struct Cluster {
+        int x0 = 0, y0 = 0, h = 0, w = 0;
+        std::vector<int> nodes;                 // 入口格子编号
+        std::vector<std::vector<int>> links;    // 每个入口在相邻簇的对应格子
+        std::vector<int> dist;                  // nodes.size()^2 的簇内距离，-1 为簇内不可达
+    };
+    // 簇边界上的入口对：first 在左 / 上簇，second 在右 / 下簇
+    typedef std::vector<std::pair<int, int>> Border;
+
+    MazeGrid map;
+    int off[4] = { 0, 0, 0, 0 };
+    int cs = 32, cRows = 0, cCols = 0;
+    std::vector<Cluster> clusters;
+    std::vector<Border> rightBorder, downBorder;    // 下标为簇编号
+    std::vector<int> nodeLocal;                     // 格子 -> 所在簇中的入口下标，-1 表示不是入口
+
+    // 查询与细化的缓冲区
+    EpochTable gCell, parentCell, closedCell;
+    IndexedHeap open;
+    std::vector<int> localDist, localParent, localQueue;
+    std::vector<std::pair<int, int>> startLinks;
+    std::vector<int> goalDist;
+
+    int clusterOf(int x, int y) const { return (x / cs) * cCols + y / cs; }
+    int clusterOfId(int id) const { return clusterOf(map.toX(id), map.toY(id)); }
+    void scanBorder(int a, bool right);
+    void rebuildNodes(int k);
+    int clusterBfs(const Cluster& c, int src, bool keepParent, int target = -1);
+    int localIndex(const Cluster& c, int id) const { return (map.toX(id) - c.x0) * c.w + (map.toY(id) - c.y0); }
+};
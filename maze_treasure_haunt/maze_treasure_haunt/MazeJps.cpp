@@ -0,0 +1,104 @@
+// 4 连通网格上的跳点搜索（JPS）
+// 规范路径约定“先竖后横”：横向移动只沿原方向前进，遇到强迫邻居才停下；
+// 竖向移动的每一步都向左右两侧做横向扫描，扫描到跳点则在当前格停下
+// 跳跃只判断墙，直接读 1 字节的原始地图
+#include "MazeCore.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+// 横向跳跃（d 为 0 右 / 2 左），返回跳点编号，撞墙返回 -1
+int MazeSolverCore::jumpH(int n, int d) const {
+    int step = off[d], up = off[3], down = off[1];
+    while (true) {
+        int prev = n;
+        n += step;
+        if (maze.map[n] == WALL) return -1;
+        if (n == endId) return n;
+        // 强迫邻居：上（下）方可走，但来时那一格的上（下）方是墙
+        if ((maze.map[n + up] != WALL && maze.map[prev + up] == WALL) ||
+            (maze.map[n + down] != WALL && maze.map[prev + down] == WALL)) return n;
+    }
+}
+
+// 竖向跳跃（d 为 1 下 / 3 上）
+int MazeSolverCore::jumpV(int n, int d) const {
+    while (true) {
+        n += off[d];
+        if (maze.map[n] == WALL) return -1;
+        if (n == endId) return n;
+        if (jumpH(n, 0) >= 0 || jumpH(n, 2) >= 0) return n;
+    }
+}
+
+// 跳点之间是直线段：沿段方向倒退，直到遇到 g 值吻合的已关闭格子即为父跳点
+void MazeSolverCore::markJumpPath() {
+    pathIds.clear();
+    int cur = endId;
+    pathIds.push_back(cur);
+    while (cur != startId) {
+        int step = off[parentDir.get(cur)];
+        int g = minG[cur];
+        int k = 0;
+        do {
+            cur -= step;
+            k++;
+            pathIds.push_back(cur);
+        } while (!(workMap[cur] == VISITED && minG[cur] == g - k));
+    }
+    reverse(pathIds.begin(), pathIds.end());
+    emitPath();
+}
+
+SolveResult MazeSolverCore::solveJPS(SearchObserver* o) {
+    if (!isReady()) return SolveResult();
+    begin(o);
+    if (!endsOpen()) return res;
+    const int INF = INT_MAX;
+    if (minG.size() != maze.map.size()) minG.resize(maze.map.size(), INF);
+    openHeap.clear();
+    openHeap.push({ calcH(startId), 0, startId });
+    minG.set(startId, 0);
+    while (!openHeap.empty()) {
+        OpenEntry cur = openHeap.pop();
+        ++res.visitedCount;
+        int cx = maze.map.toX(cur.id); int cy = maze.map.toY(cur.id);
+        if (obs) { obs->onStats(res.visitedCount, 0); obs->onCurrent(cx, cy); }
+        workMap.set(cur.id, VISITED);
+        if (cur.id == endId) { markJumpPath(); break; }
+        if (obs) obs->onVisited(cx, cy);
+
+        // 剪枝后的搜索方向
+        int dirs[4], nd = 0;
+        if (cur.id == startId) {
+            for (int i = 0; i < 4; i++) dirs[nd++] = i;
+        }else {
+            int in = parentDir.get(cur.id);
+            if (in == 0 || in == 2) {
+                dirs[nd++] = in;
+                int back = cur.id - off[in];
+                if (workMap[cur.id + off[3]] != WALL && workMap[back + off[3]] == WALL) dirs[nd++] = 3;
+                if (workMap[cur.id + off[1]] != WALL && workMap[back + off[1]] == WALL) dirs[nd++] = 1;
+            }else {
+                dirs[nd++] = in;
+                dirs[nd++] = 0;
+                dirs[nd++] = 2;
+            }
+        }
+        for (int k = 0; k < nd; k++) {
+            int d = dirs[k];
+            int j = (d == 0 || d == 2) ? jumpH(cur.id, d) : jumpV(cur.id, d);
+            if (j < 0 || workMap[j] == VISITED) continue;
+            int dist = abs(maze.map.toX(j) - cx) + abs(maze.map.toY(j) - cy);
+            int newG = cur.g + dist;
+            if (newG >= minG[j]) continue;
+            OpenEntry e = { newG + calcH(j), newG, j };
+            if (openHeap.contains(j)) { openHeap.decrease(e); res.decreaseKeys++; }
+            else openHeap.push(e);
+            minG.set(j, newG);
+            parentDir.set(j, d);
+        }
+    }
+    return res;
+}
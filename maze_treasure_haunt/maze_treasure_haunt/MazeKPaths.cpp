@@ -0,0 +1,167 @@
+// K 条最短简单路径（Yen），偏离搜索复用终点距离场
+#include "MazeCore.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <set>
+#include <unordered_map>
+
+using namespace std;
+
+static uint64_t mixCell(uint64_t h, int cell) { return (h ^ (uint64_t)(uint32_t)cell) * 0x100000001b3ull; }
+
+uint32_t MazeSolverCore::nextKToken() {
+    if (kBlock.size() != (size_t)maze.map.size() || kToken == UINT32_MAX) {
+        kBlock.assign(maze.map.size(), 0);
+        kToken = 0;
+    }
+    return ++kToken;
+}
+
+// 偏离路径：spur 到终点、避开令牌为 token 的格子、spur 不走 banned 中的方向。
+// 距离场是原图上的精确距离，删点删边后仍是一致的下界：先沿距离递减直接下降，受阻再用它做 A* 启发式
+bool MazeSolverCore::spurPath(int spur, uint8_t banned, uint32_t token, vector<int>& out, KPathsStats& st) {
+    out.clear();
+    out.push_back(spur);
+    for (int cur = spur; cur != endId; ) {
+        int next = -1;
+        for (int i = 0; i < 4 && next < 0; i++) {
+            if (cur == spur && ((banned >> i) & 1)) continue;
+            int v = cur + off[i];
+            if (distField[v] == distField[cur] - 1 && kBlock[v] != token) next = v;
+        }
+        if (next < 0) break;
+        cur = next;
+        out.push_back(cur);
+    }
+    if (out.back() == endId) { st.treeHits++; return true; }
+
+    st.searches++;
+    out.clear();
+    if (minG.size() != maze.map.size()) minG.resize(maze.map.size(), INT_MAX);
+    minG.nextEpoch();
+    kOpen.clear(distField[spur]);
+    kOpen.push({ distField[spur], 0, spur });
+    minG.set(spur, 0);
+    while (!kOpen.empty()) {
+        OpenEntry e = kOpen.pop();
+        if (e.g > minG[e.id]) continue;     // 过期条目
+        if (e.id == endId) {
+            for (int cur = endId; ; cur -= off[parentDir.get(cur)]) {
+                out.push_back(cur);
+                if (cur == spur) break;
+            }
+            reverse(out.begin(), out.end());
+            return true;
+        }
+        for (int i = 0; i < 4; i++) {
+            if (e.id == spur && ((banned >> i) & 1)) continue;
+            int v = e.id + off[i];
+            if (distField[v] < 0 || kBlock[v] == token) continue;
+            int g = e.g + 1;
+            if (g >= minG[v]) continue;
+            minG.set(v, g);
+            parentDir.set(v, i);
+            kOpen.push({ g + distField[v], g, v });
+        }
+    }
+    return false;
+}
+
+KPathsStats MazeSolverCore::solveKShortest(int k, vector<vector<pair<int, int>>>& paths) {
+    KPathsStats st;
+    paths.clear();
+    if (!isReady() || k <= 0 || !endsOpen()) return st;
+    auto t0 = chrono::steady_clock::now();
+    if (!distFieldCached()) buildDistField();
+    if (distField[startId] < 0) return st;
+
+    // 候选最多 k - |A| 条，与 A 同量级，直接保存完整路径
+    struct Cand {
+        int len;
+        long long seq;
+        uint64_t hash;
+        vector<int> cells;
+        bool operator<(const Cand& o) const { return len != o.len ? len < o.len : seq < o.seq; }
+    };
+    vector<vector<int>> A;
+    vector<uint64_t> aHash;
+    set<Cand> B;
+    unordered_map<uint64_t, int> seen;      // 路径哈希 → A 与 B 中具有该哈希的路径数
+    vector<int> share, spurBuf, full;
+    long long seq = 0;
+
+    // 哈希命中时逐格比较，哈希碰撞的不同路径不会被误判为重复
+    auto duplicate = [&](uint64_t hh, const vector<int>& p) {
+        auto it = seen.find(hh);
+        if (it == seen.end()) return false;
+        for (size_t idx = 0; idx < A.size(); idx++)
+            if (aHash[idx] == hh && A[idx] == p) return true;
+        for (const Cand& c : B)
+            if (c.hash == hh && c.cells == p) return true;
+        return false;
+    };
+
+    spurPath(startId, 0, nextKToken(), spurBuf, st);
+    A.push_back(spurBuf);
+    uint64_t h0 = 0;
+    for (int c : spurBuf) h0 = mixCell(h0, c);
+    aHash.push_back(h0);
+    seen[h0]++;
+    while ((int)A.size() < k) {
+        int pk = (int)A.size() - 1;
+        int aCount = (int)A.size();
+        int slots = k - aCount;
+        uint32_t token = nextKToken();
+        share.clear();
+        for (int idx = 0; idx < aCount; idx++) share.push_back(idx);
+        uint64_t h = 0;
+        int prevLen = (int)A[pk].size();
+        for (int i = 0; i + 1 < prevLen; i++) {
+            const vector<int>& prev = A[pk];
+            int spur = prev[i];
+            h = mixCell(h, spur);
+            if (i > 0) kBlock[prev[i - 1]] = token;     // 根路径上 spur 之前的格子
+            // 仍与 prev 共享前 i+1 格的路径，其下一步方向禁止
+            uint8_t banned = 0;
+            size_t keep = 0;
+            for (int idx : share) {
+                const vector<int>& p = A[idx];
+                if ((int)p.size() <= i || p[i] != spur) continue;
+                share[keep++] = idx;
+                if ((int)p.size() > i + 1)
+                    for (int d = 0; d < 4; d++) if (spur + off[d] == p[i + 1]) banned |= (uint8_t)(1 << d);
+            }
+            share.resize(keep);
+            st.spurNodes++;
+            if ((int)B.size() >= slots && i + 1 + distField[spur] >= B.rbegin()->len) { st.bounded++; continue; }
+            if (!spurPath(spur, banned, token, spurBuf, st)) continue;
+            int len = i + (int)spurBuf.size();
+            uint64_t hh = h;
+            for (size_t j = 1; j < spurBuf.size(); j++) hh = mixCell(hh, spurBuf[j]);
+            // 新候选序号最大，只有比 B 中最差者更短才能留下；先筛再拼路径
+            if ((int)B.size() >= slots && len >= B.rbegin()->len) continue;
+            full.assign(prev.begin(), prev.begin() + i);
+            full.insert(full.end(), spurBuf.begin(), spurBuf.end());
+            if (duplicate(hh, full)) continue;
+            B.insert({ len, seq++, hh, full });
+            seen[hh]++;
+            if ((int)B.size() > slots) {
+                auto last = std::prev(B.end());
+                if (--seen[last->hash] == 0) seen.erase(last->hash);
+                B.erase(last);
+            }
+        }
+        if (B.empty()) break;
+        auto node = B.extract(B.begin());
+        aHash.push_back(node.value().hash);
+        A.push_back(move(node.value().cells));
+    }
+    for (auto& p : A) {
+        paths.push_back(vector<pair<int, int>>());
+        for (int c : p) paths.back().push_back({ maze.map.toX(c), maze.map.toY(c) });
+    }
+    st.paths = (int)A.size();
+    st.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    return st;
+}
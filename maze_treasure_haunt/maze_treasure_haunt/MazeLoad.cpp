@@ -0,0 +1,157 @@
+// 地图加载：内存映射整个文件，二进制格式直接展开；maze.txt，手写扫描器逐行解析，出错时给出行列位置
+#include "MazeCore.h"
+#include "MazeBinary.h"
+#include "MazeMappedFile.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+// 在映射内容上前进的扫描器；行列只在出错时由偏移量换算
+struct MapScanner {
+    const char* base;
+    const char* p;
+    const char* end;
+
+    MapScanner(const char* data, size_t n) : base(data), p(data), end(data + n) {}
+
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+    // 跳过空白（含换行）
+    void skipBlank() { while (p < end && (isSpace(*p) || *p == '\n')) p++; }
+    // 跳过本行内的空白
+    void skipSpaces() { while (p < end && isSpace(*p)) p++; }
+    bool atLineEnd() const { return p >= end || *p == '\n'; }
+
+    // 读一个十进制整数（可带负号），绝对值超过 INT_MAX 视为失败
+    bool readInt(long long& v) {
+        skipBlank();
+        const char* q = p;
+        bool neg = q < end && *q == '-';
+        if (neg) q++;
+        if (q >= end || *q < '0' || *q > '9') return false;
+        v = 0;
+        while (q < end && *q >= '0' && *q <= '9') {
+            v = v * 10 + (*q++ - '0');
+            if (v > INT_MAX) return false;
+        }
+        if (neg) v = -v;
+        p = q;
+        return true;
+    }
+
+    // "第 L 行第 C 列: "，列按字节计
+    string where(const char* q) const {
+        long long line = 1 + count(base, q, '\n');
+        const char* ls = q;
+        while (ls > base && ls[-1] != '\n') ls--;
+        return "第 " + to_string(line) + " 行第 " + to_string(q - ls + 1) + " 列: ";
+    }
+    string whereLine(const char* q) const { return "第 " + to_string(1 + count(base, q, '\n')) + " 行: "; }
+};
+
+// 按 "| . . |" 的固定版式解析一行：格子在偶数偏移，奇数偏移为单个空格。
+// 无分支、步长固定，编译器可向量化；版式不符返回 false，由逐字符扫描重做并定位错误
+static bool scanRowFast(const char* s, int cols, uint8_t* row) {
+    unsigned bad = 0;
+    for (int j = 0; j < cols; j++) {
+        char c = s[2 * j];
+        row[j] = (uint8_t)(c == '.' ? ROAD : WALL);
+        bad |= (unsigned)(c != '.' && c != '|');
+    }
+    for (int j = 0; j + 1 < cols; j++) bad |= (unsigned)(s[2 * j + 1] != ' ');
+    return bad == 0;
+}
+
+// 逐字符解析一行：格子之间允许任意个空格或制表符
+static bool scanRowSlow(MapScanner& sc, int i, int cols, uint8_t* row, string& err) {
+    for (int j = 0; j < cols; j++) {
+        if (j > 0) sc.skipSpaces();
+        if (sc.atLineEnd()) {
+            err = sc.whereLine(sc.p) + "地图第 " + to_string(i + 1) + " 行只有 " + to_string(j) + " 个格子，应为 " + to_string(cols);
+            return false;
+        }
+        char c = *sc.p;
+        if (c == '|') row[j] = WALL;
+        else if (c == '.') row[j] = ROAD;
+        else {
+            err = sc.where(sc.p) + "未知字符 '" + string(1, c) + "'（应为 '|' 或 '.'）";
+            return false;
+        }
+        sc.p++;
+    }
+    return true;
+}
+
+bool loadMazeFile(const string& fname, MazeData& maze, string& err) {
+    MappedFile file;
+    if (!file.open(fname, err)) return false;
+    if (isMazeBinary(file.data(), file.size())) {
+        MazeBinaryFile bin;
+        if (!bin.openMapped(file.data(), file.size(), err)) { err = fname + ": " + err; return false; }
+        bin.unpack(maze);
+        return true;
+    }
+    MapScanner sc(file.data(), file.size());
+    MazeData m;
+    long long rows = 0, cols = 0;
+    const char* q = (sc.skipBlank(), sc.p);
+    if (!sc.readInt(rows) || !sc.readInt(cols)) { err = sc.where(sc.p) + "缺少地图行数与列数"; return false; }
+    if (rows <= 0 || cols <= 0) { err = sc.where(q) + "地图尺寸无效"; return false; }
+    if ((rows + 2 * MazeGrid::PAD) * (cols + 2 * MazeGrid::PAD) > INT_MAX) {
+        err = sc.where(q) + "地图过大（" + to_string(rows) + "x" + to_string(cols) + "）";
+        return false;
+    }
+    sc.skipSpaces();
+    if (!sc.atLineEnd()) { err = sc.where(sc.p) + "行列数之后有多余内容"; return false; }
+    m.rows = (int)rows;
+    m.cols = (int)cols;
+    m.map.assign(m.rows, m.cols, WALL);
+
+    for (int i = 0; i < m.rows; i++) {
+        sc.skipBlank();
+        if (sc.p >= sc.end) {
+            err = sc.whereLine(sc.p) + "地图数据不完整，只有 " + to_string(i) + " 行，应为 " + to_string(m.rows);
+            return false;
+        }
+        uint8_t* row = m.map.data() + m.map.id(i, 0);
+        if (sc.end - sc.p >= 2 * (ptrdiff_t)m.cols - 1 && scanRowFast(sc.p, m.cols, row)) sc.p += 2 * (ptrdiff_t)m.cols - 1;
+        else if (!scanRowSlow(sc, i, m.cols, row, err)) return false;
+        sc.skipSpaces();
+        if (!sc.atLineEnd()) {
+            if (*sc.p == '|' || *sc.p == '.') err = sc.where(sc.p) + "地图第 " + to_string(i + 1) + " 行的格子多于 " + to_string(m.cols) + " 个";
+            else err = sc.where(sc.p) + "未知字符 '" + string(1, *sc.p) + "'（应为 '|' 或 '.'）";
+            return false;
+        }
+    }
+
+    long long v[4];
+    const char* pos[4];
+    for (int k = 0; k < 4; k++) {
+        sc.skipBlank();
+        pos[k] = sc.p;
+        if (!sc.readInt(v[k])) {
+            err = sc.where(sc.p) + (sc.p >= sc.end ? "缺少起点或终点" : "起点或终点坐标无效");
+            return false;
+        }
+    }
+    for (int k = 0; k < 4; k++) {
+        long long lim = (k % 2 == 0) ? m.rows : m.cols;
+        if (v[k] < 0 || v[k] >= lim) {
+            err = sc.where(pos[k]) + (k < 2 ? "起点" : "终点") + "坐标 (" + to_string(v[k & 2]) + ", " + to_string(v[(k & 2) + 1]) +
+                ") 越界，地图为 " + to_string(m.rows) + "x" + to_string(m.cols);
+            return false;
+        }
+    }
+    for (int k = 0; k < 4; k += 2) {
+        if (m.map.at((int)v[k], (int)v[k + 1]) == WALL) {
+            err = sc.where(pos[k]) + (k < 2 ? "起点" : "终点") + "坐标 (" + to_string(v[k]) + ", " + to_string(v[k + 1]) + ") 位于墙上";
+            return false;
+        }
+    }
+    sc.skipBlank();
+    if (sc.p < sc.end) { err = sc.where(sc.p) + "终点之后有多余内容"; return false; }
+    m.startX = (int)v[0]; m.startY = (int)v[1];
+    m.endX = (int)v[2]; m.endY = (int)v[3];
+    maze = move(m);
+    return true;
+}
@@ -0,0 +1,71 @@
+// 只读内存映射文件
+#include "MazeMappedFile.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+#ifdef _WIN32
+
+bool MappedFile::open(const string& fname, string& err) {
+    close();
+    HANDLE f = CreateFileA(fname.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE) { err = "无法打开文件: " + fname; return false; }
+    LARGE_INTEGER sz;
+    if (!GetFileSizeEx(f, &sz)) { CloseHandle(f); err = "无法读取文件大小: " + fname; return false; }
+    fileHandle = f;
+    opened = true;
+    len = (size_t)sz.QuadPart;
+    if (len == 0) return true;
+    HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m) { close(); err = "无法映射文件: " + fname; return false; }
+    mapHandle = m;
+    ptr = (const char*)MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+    if (!ptr) { close(); err = "无法映射文件: " + fname; return false; }
+    return true;
+}
+
+void MappedFile::close() {
+    if (ptr) UnmapViewOfFile(ptr);
+    if (mapHandle) CloseHandle((HANDLE)mapHandle);
+    if (fileHandle) CloseHandle((HANDLE)fileHandle);
+    ptr = nullptr; mapHandle = nullptr; fileHandle = nullptr;
+    len = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::open(const string& fname, string& err) {
+    close();
+    fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0) { err = "无法打开文件: " + fname; return false; }
+    struct stat sb;
+    if (fstat(fd, &sb) != 0 || !S_ISREG(sb.st_mode)) { close(); err = "不是普通文件: " + fname; return false; }
+    opened = true;
+    len = (size_t)sb.st_size;
+    if (len == 0) return true;
+    void* p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) { close(); err = "无法映射文件: " + fname; return false; }
+    madvise(p, len, MADV_SEQUENTIAL);   // 只顺序扫描一遍，提示内核加大预读
+    ptr = (const char*)p;
+    return true;
+}
+
+void MappedFile::close() {
+    if (ptr) munmap((void*)ptr, len);
+    if (fd >= 0) ::close(fd);
+    ptr = nullptr;
+    fd = -1;
+    len = 0;
+    opened = false;
+}
+
+#endif
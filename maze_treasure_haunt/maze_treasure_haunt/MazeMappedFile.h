@@ -0,0 +1,31 @@
+﻿#pragma once
+// 只读内存映射文件：POSIX 下用 mmap，Windows 下用 CreateFileMapping；内容在对象存活期间有效
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+    MappedFile() {}
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 映射整个文件；空文件也算成功（data 为空指针，size 为 0）
+    bool open(const std::string& fname, std::string& err);
+    void close();
+
+    const char* data() const { return ptr; }
+    size_t size() const { return len; }
+    bool isOpen() const { return opened; }
+
+private:
+    const char* ptr = nullptr;
+    size_t len = 0;
+    bool opened = false;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mapHandle = nullptr;
+#else
+    int fd = -1;
+#endif
+};
@@ -0,0 +1,100 @@
+// 多线程按层同步 BFS
+// 每层把前沿按队列下标切块并行扩展，邻居用 CAS 写入“发现它的最小前沿下标”来抢占；
+// 本层结束后各块只保留自己抢到的格子，按块顺序拼接到队列尾部。
+// 这样每层的顺序与单线程队列完全相同，前驱即 q[claim[格子]]，路径也一致
+#include "MazeCore.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+static const int PAR_MIN_LEVEL = 4096;   // 前沿小于此值时单块执行，省去线程同步
+
+void MazeSolverCore::runParallelBFS() {
+    int n = maze.map.size();
+    if (claimSize != n) { claim.reset(new atomic<int>[n]); claimSize = n; }
+    for (int i = 0; i < n; i++) claim[i].store(INT_MAX, memory_order_relaxed);
+    const uint8_t* grid = maze.map.data();
+    vector<int>& q = frontier;
+    q.push_back(startId);
+    claim[startId].store(-1, memory_order_relaxed);
+    int lo = 0, hi = 1;
+    int endPos = (startId == endId) ? 0 : -1;
+    vector<size_t> base;
+    while (endPos < 0 && lo < hi) {
+        int len = hi - lo;
+        if (len < PAR_MIN_LEVEL || pool.size() == 1) {
+            // 小层直接在调用线程上追加到队列尾部
+            for (int i = lo; i < hi; i++) {
+                int u = q[i];
+                for (int d = 0; d < 4; d++) {
+                    int v = u + off[d];
+                    if (grid[v] == WALL || claim[v].load(memory_order_relaxed) != INT_MAX) continue;
+                    claim[v].store(i, memory_order_relaxed);
+                    q.push_back(v);
+                }
+            }
+            lo = hi;
+            hi = (int)q.size();
+            if (claim[endId].load(memory_order_relaxed) != INT_MAX)
+                endPos = (int)(find(q.begin() + lo, q.begin() + hi, endId) - q.begin());
+            continue;
+        }
+        int chunks = pool.size() * 4;
+        if ((int)chunkFound.size() < chunks) chunkFound.resize(chunks);
+        auto range = [&](int c, int& a, int& b) {
+            a = lo + (int)((long long)len * c / chunks);
+            b = lo + (int)((long long)len * (c + 1) / chunks);
+        };
+        // 扩展：对每个邻居做 CAS 取最小下标
+        pool.run(chunks, [&](int c) {
+            int a, b;
+            range(c, a, b);
+            vector<int>& out = chunkFound[c];
+            out.clear();
+            for (int i = a; i < b; i++) {
+                int u = q[i];
+                for (int d = 0; d < 4; d++) {
+                    int v = u + off[d];
+                    if (grid[v] == WALL) continue;
+                    int old = claim[v].load(memory_order_relaxed);
+                    while (old > i && !claim[v].compare_exchange_weak(old, i, memory_order_relaxed)) {}
+                    if (old > i) out.push_back(v);
+                }
+            }
+        });
+        // 过滤：只保留最终归本块所有的格子（被更小下标抢走的丢弃）
+        pool.run(chunks, [&](int c) {
+            int a, b;
+            range(c, a, b);
+            vector<int>& out = chunkFound[c];
+            size_t k = 0;
+            for (int v : out) {
+                int w = claim[v].load(memory_order_relaxed);
+                if (w >= a && w < b) out[k++] = v;
+            }
+            out.resize(k);
+        });
+        // 拼接：按块顺序写入队列尾部
+        base.assign(chunks, 0);
+        size_t total = hi;
+        for (int c = 0; c < chunks; c++) { base[c] = total; total += chunkFound[c].size(); }
+        q.resize(total);
+        pool.run(chunks, [&](int c) {
+            copy(chunkFound[c].begin(), chunkFound[c].end(), q.begin() + base[c]);
+        });
+        lo = hi;
+        hi = (int)total;
+        if (claim[endId].load(memory_order_relaxed) != INT_MAX)
+            endPos = (int)(find(q.begin() + lo, q.begin() + hi, endId) - q.begin());
+    }
+    if (endPos < 0) { res.visitedCount = hi; return; }
+    res.visitedCount = endPos + 1;          // 与单线程一致：终点出队时停止
+    pathIds.clear();
+    for (int cur = endId; ; cur = q[claim[cur].load(memory_order_relaxed)]) {
+        pathIds.push_back(cur);
+        if (cur == startId) break;
+    }
+    reverse(pathIds.begin(), pathIds.end());
+    emitPath();
+}
@@ -0,0 +1,222 @@
+// 简单路径计数：逐格推进的前沿动态规划（插头 DP），计数用多字大整数
+#include "MazeCore.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+// 插头：0 无，1 左括号，2 右括号（一段未完成路径的两端），3 已接到起点或终点的一端
+// 前沿有 width + 1 个插头，每个 2 位：处理第 p 格前，位置 p 为左侧插头，p + 1 为上方插头
+static inline int plugAt(uint64_t s, int k) { return (int)(s >> (2 * k)) & 3; }
+static inline uint64_t plugSet(uint64_t s, int k, int v) { return (s & ~(3ull << (2 * k))) | ((uint64_t)v << (2 * k)); }
+
+// 与位置 k 的括号配对的另一端
+static int matchPlug(uint64_t s, int k, int width) {
+    int depth = 0;
+    if (plugAt(s, k) == 1) {
+        for (int i = k; i <= width; i++) {
+            int v = plugAt(s, i);
+            if (v == 1) depth++;
+            else if (v == 2 && --depth == 0) return i;
+        }
+    }else {
+        for (int i = k; i >= 0; i--) {
+            int v = plugAt(s, i);
+            if (v == 2) depth++;
+            else if (v == 1 && --depth == 0) return i;
+        }
+    }
+    return -1;
+}
+
+// 一层状态：开放寻址哈希表，计数按状态连续存放，每个 limbs 个 32 位字
+struct CountLayer {
+    vector<uint64_t> keys;
+    vector<uint32_t> counts;
+    vector<int> table;
+    int shift = 54;             // 64 - log2(表长)
+    int limbs = 1;
+
+    void clear(int w) {
+        keys.clear();
+        counts.clear();
+        limbs = w;
+        if (table.empty()) table.assign((size_t)1 << (64 - shift), -1);
+        else fill(table.begin(), table.end(), -1);
+    }
+    size_t size() const { return keys.size(); }
+
+    size_t slotOf(uint64_t key) const {
+        size_t mask = table.size() - 1;
+        size_t h = (size_t)((key * 0x9E3779B97F4A7C15ull) >> shift);
+        while (table[h] >= 0 && keys[table[h]] != key) h = (h + 1) & mask;
+        return h;
+    }
+
+    void rehash() {
+        shift--;
+        table.assign((size_t)1 << (64 - shift), -1);
+        for (size_t i = 0; i < keys.size(); i++) table[slotOf(keys[i])] = (int)i;
+    }
+
+    // 计数增加一位字
+    void widen() {
+        vector<uint32_t> wide(keys.size() * (limbs + 1), 0);
+        for (size_t i = 0; i < keys.size(); i++)
+            copy(counts.begin() + i * limbs, counts.begin() + (i + 1) * limbs, wide.begin() + i * (limbs + 1));
+        counts.swap(wide);
+        limbs++;
+    }
+
+    void add(uint64_t key, const uint32_t* v, int n) {
+        if (keys.size() * 2 >= table.size()) rehash();
+        size_t slot = slotOf(key);
+        if (table[slot] < 0) {
+            table[slot] = (int)keys.size();
+            keys.push_back(key);
+            counts.resize(counts.size() + limbs, 0);
+        }
+        while (n > limbs) widen();
+        size_t base = (size_t)table[slot] * limbs;
+        uint64_t carry = 0;
+        for (int i = 0; i < limbs; i++) {
+            carry += (uint64_t)counts[base + i] + (i < n ? v[i] : 0);
+            counts[base + i] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        if (carry) {
+            widen();
+            counts[(size_t)table[slot] * limbs + limbs - 1] = (uint32_t)carry;
+        }
+    }
+};
+
+static void addBig(vector<uint32_t>& acc, const uint32_t* v, int n) {
+    if ((int)acc.size() < n) acc.resize(n, 0);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < acc.size(); i++) {
+        carry += (uint64_t)acc[i] + ((int)i < n ? v[i] : 0);
+        acc[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    if (carry) acc.push_back((uint32_t)carry);
+}
+
+// 大整数转十进制：反复除以 1e9
+static string bigToString(vector<uint32_t> v) {
+    while (!v.empty() && v.back() == 0) v.pop_back();
+    if (v.empty()) return "0";
+    vector<uint32_t> parts;
+    while (!v.empty()) {
+        uint64_t rem = 0;
+        for (size_t i = v.size(); i-- > 0; ) {
+            uint64_t cur = (rem << 32) | v[i];
+            v[i] = (uint32_t)(cur / 1000000000u);
+            rem = cur % 1000000000u;
+        }
+        parts.push_back((uint32_t)rem);
+        while (!v.empty() && v.back() == 0) v.pop_back();
+    }
+    string s = to_string(parts.back());
+    char buf[16];
+    for (size_t i = parts.size() - 1; i-- > 0; ) {
+        snprintf(buf, sizeof(buf), "%09u", parts[i]);
+        s += buf;
+    }
+    return s;
+}
+
+PathCountStats countSimplePaths(const MazeData& maze, size_t maxStates) {
+    PathCountStats st;
+    if (maze.empty()) return st;
+    auto t0 = chrono::steady_clock::now();
+    const MazeGrid& g = maze.map;
+    // 沿较长的一边推进，前沿取较短的一边；简单路径数与转置无关
+    bool byRow = maze.cols <= maze.rows;
+    int width = byRow ? maze.cols : maze.rows;
+    int lines = byRow ? maze.rows : maze.cols;
+    st.width = width;
+    if (width + 1 > 32) return st;
+    auto open = [&](int l, int p) {
+        if (l >= lines || p >= width) return false;
+        return (byRow ? g.at(l, p) : g.at(p, l)) != WALL;
+    };
+    int sl = byRow ? maze.startX : maze.startY, sp = byRow ? maze.startY : maze.startX;
+    int el = byRow ? maze.endX : maze.endY, ep = byRow ? maze.endY : maze.endX;
+    if (!open(sl, sp) || !open(el, ep)) { st.ok = true; st.count = "0"; return st; }
+    if (sl == el && sp == ep) { st.ok = true; st.count = "1"; return st; }
+
+    vector<uint32_t> total;
+    CountLayer cur, next;
+    cur.clear(1);
+    const uint32_t one = 1;
+    cur.add(0, &one, 1);
+    const uint64_t lineMask = (width + 1 >= 32) ? ~0ull : ((1ull << (2 * (width + 1))) - 1);
+    for (int l = 0; l < lines; l++) {
+        for (int p = 0; p < width; p++) {
+            next.clear(cur.limbs);
+            bool cell = open(l, p), end = (l == sl && p == sp) || (l == el && p == ep);
+            bool down = open(l + 1, p), right = open(l, p + 1);
+            for (size_t i = 0; i < cur.size(); i++) {
+                uint64_t s = cur.keys[i];
+                const uint32_t* c = &cur.counts[i * cur.limbs];
+                int n = cur.limbs;
+                int a = plugAt(s, p), b = plugAt(s, p + 1);
+                uint64_t base = plugSet(plugSet(s, p, 0), p + 1, 0);
+                if (!cell) {
+                    if (a == 0 && b == 0) next.add(s, c, n);
+                    continue;
+                }
+                if (end) {
+                    // 起终点度为 1
+                    if (a == 0 && b == 0) {
+                        if (down) next.add(plugSet(base, p, 3), c, n);
+                        if (right) next.add(plugSet(base, p + 1, 3), c, n);
+                    }else if (a == 0 || b == 0) {
+                        int x = a | b;
+                        int k = a ? p : p + 1;
+                        if (x == 3) { if (base == 0) addBig(total, c, n); }
+                        else next.add(plugSet(base, matchPlug(s, k, width), 3), c, n);
+                    }
+                    continue;
+                }
+                if (a == 0 && b == 0) {
+                    next.add(s, c, n);                  // 不经过此格
+                    if (down && right) next.add(plugSet(plugSet(base, p, 1), p + 1, 2), c, n);
+                }else if (a == 0 || b == 0) {
+                    int x = a | b;
+                    if (down) next.add(plugSet(base, p, x), c, n);
+                    if (right) next.add(plugSet(base, p + 1, x), c, n);
+                }else if (a == 1 && b == 1) {
+                    next.add(plugSet(base, matchPlug(s, p + 1, width), 1), c, n);
+                }else if (a == 2 && b == 2) {
+                    next.add(plugSet(base, matchPlug(s, p, width), 2), c, n);
+                }else if (a == 2 && b == 1) {
+                    next.add(base, c, n);
+                }else if (a == 3 && b == 3) {
+                    if (base == 0) addBig(total, c, n);   // 起点段与终点段相接，其余格子都不再经过
+                }else if (a == 3 || b == 3) {
+                    int k = (a == 3) ? p + 1 : p;
+                    next.add(plugSet(base, matchPlug(s, k, width), 3), c, n);
+                }
+                // a == 1 && b == 2 会闭合成环，舍弃
+            }
+            swap(cur, next);
+            st.peakStates = max(st.peakStates, cur.size());
+            st.limbs = max(st.limbs, cur.limbs);
+            if (cur.size() > maxStates) {
+                st.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+                return st;
+            }
+        }
+        // 换行：最右插头必为空，整体右移一位，新行左侧插头为空
+        next.clear(cur.limbs);
+        for (size_t i = 0; i < cur.size(); i++) next.add((cur.keys[i] << 2) & lineMask, &cur.counts[i * cur.limbs], cur.limbs);
+        swap(cur, next);
+    }
+    st.ok = true;
+    st.limbs = max(st.limbs, (int)total.size());
+    st.count = bigToString(total);
+    st.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    return st;
+}
@@ -0,0 +1,92 @@
+﻿#pragma once
+// 简单线程池：常驻工作线程，run(n, fn) 把 0..n-1 号任务分给各线程（含调用线程）并等待全部完成
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable cvStart, cvDone;
+    const std::function<void(int)>* job = nullptr;
+    int taskCount = 0;
+    std::atomic<int> nextTask{ 0 };
+    int running = 0;            // 本轮尚未完成的工作线程数
+    unsigned round = 0;         // 轮次号，变化即唤醒工作线程
+    bool stopping = false;
+
+    void drain() {
+        int i;
+        while ((i = nextTask.fetch_add(1)) < taskCount) (*job)(i);
+    }
+
+    // seen 为创建时的轮次号：resize 之后新线程不能把之前已完成的轮次当成新任务
+    void workerLoop(unsigned seen) {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lk(mtx);
+                cvStart.wait(lk, [&] { return stopping || round != seen; });
+                if (stopping) return;
+                seen = round;
+            }
+            drain();
+            std::lock_guard<std::mutex> lk(mtx);
+            if (--running == 0) cvDone.notify_one();
+        }
+    }
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            stopping = true;
+        }
+        cvStart.notify_all();
+        for (auto& t : workers) t.join();
+        workers.clear();
+        stopping = false;
+    }
+
+public:
+    explicit ThreadPool(int threads = 1) { resize(threads); }
+    ~ThreadPool() { shutdown(); }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 总线程数（含调用线程）
+    int size() const { return (int)workers.size() + 1; }
+
+    void resize(int threads) {
+        if (threads < 1) threads = 1;
+        if (threads == size()) return;
+        shutdown();
+        unsigned r;
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            r = round;
+        }
+        for (int i = 1; i < threads; i++) workers.emplace_back(&ThreadPool::workerLoop, this, r);
+    }
+
+    void run(int tasks, const std::function<void(int)>& fn) {
+        if (workers.empty() || tasks <= 1) {
+            for (int i = 0; i < tasks; i++) fn(i);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            job = &fn;
+            taskCount = tasks;
+            nextTask = 0;
+            running = (int)workers.size();
+            round++;
+        }
+        cvStart.notify_all();
+        drain();
+        std::unique_lock<std::mutex> lk(mtx);
+        cvDone.wait(lk, [&] { return running == 0; });
+    }
+};
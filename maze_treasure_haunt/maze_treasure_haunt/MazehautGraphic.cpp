@@ -1,4 +1,5 @@
 #include <graphics.h>       // EasyXͼοͷļ
+#include "MazeCore.h"       // ޽
 #include <iostream>
 #include <vector>
 #include <string>
@@ -35,12 +36,6 @@ const COLORREF C_BTN_IDLE = RGB(64, 169, 255);
 const COLORREF C_BTN_HOVER = RGB(105, 192, 255);
 const COLORREF C_BTN_TEXT = RGB(255, 255, 255);
 
-// ͼ״̬
-const int WALL = 0;
-const int ROAD = 1;
-const int VISITED = 2;
-const int PATH = 3;
-
 // ٶ ()
 const int DELAY_TIME = 100;
 
@@ -61,18 +56,19 @@ string openFileDialog() {
     return "";
 }
 
-// ڵṹ
-struct Node {
-    int x, y;
-    Node* parent;
-    int g, h, f; 
-
-    Node(int _x, int _y, Node* _p = nullptr) : x(_x), y(_y), parent(_p), g(0), h(0), f(0) {}
-    Node(int _x, int _y, Node* _p, int _g, int _h) : x(_x), y(_y), parent(_p), g(_g), h(_h) { f = g + h; }
-
-	// شںţȶбȽ
-    bool operator>(const Node& other) const { return f > other.f; }
-};
+// ĿʾϢΪ UTF-8水 ANSI ҳת
+string utf8ToAnsi(const string& s) {
+    int wn = MultiByteToWideChar(CP_UTF8, 0, s.c_str(), -1, NULL, 0);
+    if (wn <= 0) return s;
+    wstring w(wn, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, s.c_str(), -1, &w[0], wn);
+    int an = WideCharToMultiByte(CP_ACP, 0, w.c_str(), -1, NULL, 0, NULL, NULL);
+    if (an <= 0) return s;
+    string a(an, '\0');
+    WideCharToMultiByte(CP_ACP, 0, w.c_str(), -1, &a[0], an, NULL, NULL);
+    a.resize(an - 1);
+    return a;
+}
 
 // ť
 class Button {
@@ -105,11 +101,10 @@ public:
     bool isClicked(int mx, int my) { return hover; }
 };
 
-// Թ
-class MazeSolver {
+// Թࣺ߼ MazeSolverCore Уֻ
+class MazeSolver : public SearchObserver {
 private:
-    vector<vector<int>> mazeMap; // ԭʼͼ
-    vector<vector<int>> workMap; // ͼ
+    MazeSolverCore core;
     int rows, cols;
     int startX, startY, endX, endY;
 
@@ -123,11 +118,6 @@ private:
 
     int cellSize;           // ԹӴС
 	int offsetX, offsetY;   // ͼƫ
-    // Ѱ
-	int dx[4] = { 0, 1, 0, -1 };     
-    int dy[4] = { 1, 0, -1, 0 };
-    // ڴ
-    vector<Node*> garbageCollection; 
 
     // Ƶ
     void drawCell(int r, int c, COLORREF color) {
@@ -154,8 +144,16 @@ private:
         offsetY = (WIN_HEIGHT - totalMapH) / 2;
     }
 
-    // پ
-    int calcH(int x, int y) const { return abs(x - endX) + abs(y - endY); }
+    // ͬеĵͼϢ
+    void syncMaze(const MazeData& m) {
+        core.setMaze(m);
+        rows = m.rows; cols = m.cols;
+        startX = m.startX; startY = m.startY;
+        endX = m.endX; endY = m.endY;
+    }
+
+    bool isStart(int x, int y) const { return x == startX && y == startY; }
+    bool isEnd(int x, int y) const { return x == endX && y == endY; }
 
     // ־Ϣ
     void drawSidePanel() {
@@ -214,8 +212,7 @@ private:
         }
     }
 public:
-    MazeSolver() : rows(0), cols(0), cellSize(30), offsetX(0), offsetY(0) {}
-    ~MazeSolver() { clearMemory(); }
+    MazeSolver() : rows(0), cols(0), startX(0), startY(0), endX(0), endY(0), cellSize(30), offsetX(0), offsetY(0) {}
 
     // ־
     void log(string msg, string sub = "") {
@@ -231,20 +228,46 @@ public:
         drawSidePanel();
     }
 
-    // ж̬Ľڵ
-    void clearMemory() {
-        for (auto node : garbageCollection) delete node;
-        garbageCollection.clear();
+    // ۲߻ص̶
+    void onStats(int visited, int pathLen) override { updateStats(visited, pathLen); }
+    void onCurrent(int x, int y) override {
+        if (!isStart(x, y)) drawCell(x, y, C_CURRENT);
+        Sleep(DELAY_TIME);
+    }
+    void onVisited(int x, int y) override {
+        if (!isStart(x, y)) drawCell(x, y, C_VISITED);
+    }
+    void onPathCell(int x, int y) override {
+        if (!(isStart(x, y) || isEnd(x, y))) {
+            drawCell(x, y, C_PATH);
+            Sleep(DELAY_TIME / 2);
+        }
+    }
+    void onStepIn(int x, int y) override {
+        if (!isStart(x, y)) {
+            drawCell(x, y, C_PATH);
+            Sleep(DELAY_TIME);
+        }
+    }
+    void onStepOut(int x, int y) override { drawCell(x, y, C_VISITED); }
+    void onPathFound(int index) override {
+        totalPathCount = index;
+        drawCell(endX, endY, C_END);
+        char buffer[50];
+        sprintf_s(buffer, "ֵ %d ·", index);
+        log("ҵ·!", buffer);
+        Sleep(DELAY_TIME * 15);
     }
 
 	// Ƴʼͼ
     void drawInitialMap() {
-        if (mazeMap.empty()) return;
+        const MazeData& m = core.data();
+        if (m.empty()) return;
         setfillcolor(C_BG);
         solidrectangle(0, 0, MAP_AREA_WIDTH, WIN_HEIGHT);
         for (int i = 0; i < rows; i++) {
             for (int j = 0; j < cols; j++) {
-                drawCell(i, j, (mazeMap[i][j] == WALL) ? C_WALL : C_ROAD);
+                drawCell(i, j, (m.map.at(i, j) == WALL) ? C_WALL : C_ROAD);
             }
         }
         drawCell(startX, startY, C_START);
@@ -256,105 +279,43 @@ public:
     void loadMapGUI() {
         string fname = openFileDialog();
         if (fname.empty()) return;
-        ifstream file(fname);
-        if (!file.is_open()) { log("", "ȡļʧܣ"); return; }
-        file >> rows >> cols;
-        mazeMap.assign(rows, vector<int>(cols));
-        char ch;
-        for (int i = 0; i < rows; i++) {
-            for (int j = 0; j < cols; j++) {
-                file >> ch;
-                if(ch=='|') mazeMap[i][j] = WALL;
-                else if(ch=='.') mazeMap[i][j] = ROAD;
-            }
-        }
-        file >> startX >> startY >> endX >> endY;
-        file.close();
+        MazeData m;
+        string err;
+        if (!loadMazeFile(fname, m, err)) { log("ȡļʧܣ", utf8ToAnsi(err)); return; }
+        syncMaze(m);
 
         calcLayout();
-        workMap = mazeMap;
         log("ͼسɹ", "ѡҪʾĵͼ㷨");
         drawInitialMap();
     }
 
     // ɵͼ
     void generateMaze() {
-        rows = 21; cols = 29;       // ʹߴ磬֤Χǽ
-        mazeMap.assign(rows, vector<int>(cols, WALL));
-        stack<Node*> s;
-        int sx = 1, sy = 1;         // 
-        mazeMap[sx][sy] = ROAD;
-        s.push(new Node(sx, sy)); 
-        srand((unsigned)time(NULL));// ʼ
-        while (!s.empty()) {
-            Node* cur = s.top();
-            vector<int> dirs;
-            // ܾΪ2λǷΪǽ
-            if (cur->x + 2 < rows - 1 && mazeMap[cur->x + 2][cur->y] == WALL) dirs.push_back(0); // 
-            if (cur->y + 2 < cols - 1 && mazeMap[cur->x][cur->y + 2] == WALL) dirs.push_back(1); // 
-            if (cur->x - 2 > 0 && mazeMap[cur->x - 2][cur->y] == WALL) dirs.push_back(2); // 
-            if (cur->y - 2 > 0 && mazeMap[cur->x][cur->y - 2] == WALL) dirs.push_back(3); // 
-         
-            if (!dirs.empty()) {
-                int dir = dirs[rand() % dirs.size()];    // ѡһ
-                int nx = cur->x, ny = cur->y;
-                int mx = cur->x, my = cur->y;
-                switch (dir) {
-                    case 0: nx += 2; mx += 1; break;
-                    case 1: ny += 2; my += 1; break;
-                    case 2: nx -= 2; mx -= 1; break;
-                    case 3: ny -= 2; my -= 1; break;
-                }
-                mazeMap[mx][my] = ROAD; // ͨǽ
-                mazeMap[nx][ny] = ROAD; // ͨĿ
-                s.push(new Node(nx, ny));
-            }else{
-                delete cur; 
-                s.pop(); // 
-            }
-        }
-        startX = 1; startY = 1;
-        endX = rows - 2; endY = cols - 2;
+        MazeData m;
+        generateMazeData(m);        // ʹߴ磬֤Χǽ
+        syncMaze(m);
 
         calcLayout();
-        workMap = mazeMap;
         log("", "ɽԹѾ");
         drawInitialMap();
     }
     // õͼ
     void reset() {
-        if (mazeMap.empty()) { log("ͼδ"); return; }
-        workMap = mazeMap;
-        clearMemory();
+        if (!core.isReady()) { log("ͼδ"); return; }
+        core.reset();
         updateStats(0, 0);       // ݹ
         drawInitialMap();
         log("״̬");
     }
     // ͼǷ
     bool isReady() {
-        if (mazeMap.empty()) { log("ȼصͼ!"); return false; }
+        if (!core.isReady()) { log("ȼصͼ!"); return false; }
         return true;
     }
-    // ڵǷЧ
-    bool isValid(int x, int y, const vector<vector<int>>& m) const {
-        return (x >= 0 && x < rows && y >= 0 && y < cols && m[x][y] != WALL);
-    }
-    // ƻ·
-    void markPath(Node* endNode) {
-        Node* cur = endNode;
-        int len = 0;
-        while (cur != nullptr) {
-            len++;
-            workMap[cur->x][cur->y] = PATH;
-            if (!((cur->x == startX && cur->y == startY) || (cur->x == endX && cur->y == endY))) {
-                drawCell(cur->x, cur->y, C_PATH);
-                Sleep(DELAY_TIME / 2);
-            }
-            cur = cur->parent;
-        }
+    // ·
+    void finishPath() {
         drawCell(startX, startY, C_START);
         drawCell(endX, endY, C_END);
-        updateStats(visitedCount, len); // ·
         log("", "·ʾ");
     }
 
@@ -363,37 +324,9 @@ public:
         if (!isReady()) return;
         reset();
         log(" DFS...", "");
-        stack<Node*> s;
-        Node* start = new Node(startX, startY);
-        garbageCollection.push_back(start);
-        s.push(start);
-        workMap[startX][startY] = VISITED;
-        bool found = false;
-        while (!s.empty()) {
-            Node* cur = s.top(); s.pop();
-            updateStats(++visitedCount, 0); 
-            // Ƶǰ
-            if (!(cur->x == startX && cur->y == startY))
-                drawCell(cur->x, cur->y, C_CURRENT);
-            Sleep(DELAY_TIME);
-            // ҵյ
-            if (cur->x == endX && cur->y == endY) { markPath(cur); found = true; break; }
-            // ѷ
-            if (!(cur->x == startX && cur->y == startY))
-                drawCell(cur->x, cur->y, C_VISITED);
-            // ջ֤DFS˳
-            for (int i = 3; i >= 0; i--) {
-                int nx = cur->x + dx[i];
-                int ny = cur->y + dy[i];
-                if (isValid(nx, ny, workMap) && workMap[nx][ny] != VISITED) {
-                    workMap[nx][ny] = VISITED;
-                    Node* nextNode = new Node(nx, ny, cur);
-                    garbageCollection.push_back(nextNode);
-                    s.push(nextNode);
-                }
-            }
-        }
-        if (!found) log("DFS ޽");
+        SolveResult r = core.solveDFS(this);
+        if (r.found) finishPath();
+        else log("DFS ޽");
     }
 
     // BFS
@@ -401,121 +334,30 @@ public:
         if (!isReady()) return;
         reset();
         log(" BFS...", "");
-        queue<Node*> q;
-        Node* start = new Node(startX, startY);
-        garbageCollection.push_back(start);
-        q.push(start);
-        workMap[startX][startY] = VISITED;
-        bool found = false;
-        while (!q.empty()) {
-            Node* cur = q.front(); q.pop();
-            updateStats(++visitedCount, 0);
-            if (!(cur->x == startX && cur->y == startY))
-                drawCell(cur->x, cur->y, C_CURRENT);
-            Sleep(DELAY_TIME);
-            if (cur->x == endX && cur->y == endY) { markPath(cur); found = true; break; }
-            if (!(cur->x == startX && cur->y == startY)) {
-                drawCell(cur->x, cur->y, C_VISITED);
-            }
-            for (int i = 0; i < 4; i++) {
-                int nx = cur->x + dx[i], ny = cur->y + dy[i];
-                if (isValid(nx, ny, workMap) && workMap[nx][ny] != VISITED) {
-                    workMap[nx][ny] = VISITED;
-                    Node* next = new Node(nx, ny, cur);
-                    garbageCollection.push_back(next);
-                    q.push(next);
-                }
-            }
-        }
-        if (!found) log("BFS ޽");
+        SolveResult r = core.solveBFS(this);
+        if (r.found) finishPath();
+        else log("BFS ޽");
     }
 
-    // A* 
+    // A*
     void solveAStar() {
         if (!isReady()) return;
         reset();
         log(" A*...", "ʽ");
-        priority_queue<Node, vector<Node>, greater<Node>> pq;
-        vector<vector<int>> minG(rows, vector<int>(cols, 999999));
-        Node* root = new Node(startX, startY, nullptr, 0, calcH(startX, startY));
-        garbageCollection.push_back(root);
-        pq.push(*root);
-        minG[startX][startY] = 0;
-        bool found = false;
-        while (!pq.empty()) {
-            Node currentObj = pq.top();        
-            pq.pop();               // ȡ F ֵС
-            Node* currPtr = new Node(currentObj);      // ʱջõĶѱcurrentObjǾֲcurrPtrֻҪdeleteһֱڣ
-            garbageCollection.push_back(currPtr);
-            updateStats(++visitedCount, 0);
-            int cx = currPtr->x; int cy = currPtr->y;
-            if (!(cx == startX && cy == startY))
-                drawCell(cx, cy, C_CURRENT);
-            Sleep(DELAY_TIME);
-            if (cx == endX && cy == endY) { markPath(currPtr); found = true; break; }
-            workMap[cx][cy] = VISITED;
-            if (!(cx == startX && cy == startY))
-                drawCell(cx, cy, C_VISITED);
-            for (int i = 0; i < 4; i++) {
-                int nx = cx + dx[i]; int ny = cy + dy[i];
-                if (isValid(nx, ny, workMap)) {
-                    int newG = currPtr->g + 1;
-                    if (newG < minG[nx][ny]) {       // ֻз̵ָ·Ÿ
-                        minG[nx][ny] = newG;
-                        Node nextNode(nx, ny, currPtr, newG, calcH(nx, ny));    // ָָڴȹָ
-                        pq.push(nextNode);
-                    }
-                }
-            }
-        }
-        if (!found) log("A* ޽");
+        SolveResult r = core.solveAStar(this);
+        if (r.found) finishPath();
+        else log("A* ޽");
     }
 
-    // Ѱ· 
-    void solveAllPathsHelper(int x, int y, int currentStep) {
-        if (totalPathCount >= 10) return;
-        visitedCount++;
-        updateStats(visitedCount, currentStep);
-        workMap[x][y] = PATH;
-        // ҵյ
-        if (x == endX && y == endY) {
-            totalPathCount++;
-            drawCell(x, y, C_END);
-            char buffer[50];
-            sprintf_s(buffer, "ֵ %d ·", totalPathCount);
-            log("ҵ·!", buffer);
-            Sleep(DELAY_TIME * 15); 
-            workMap[x][y] = ROAD;   // 
-            return;
-        }
-        // ·
-        if (!(x == startX && y == startY)) {
-            drawCell(x, y, C_PATH);
-            Sleep(DELAY_TIME);
-        }
-        for (int i = 0; i < 4; i++) {
-            if (totalPathCount >= 10) break;
-            int nx = x + dx[i];
-            int ny = y + dy[i];
-
-            if (isValid(nx, ny, workMap) && workMap[nx][ny] != PATH) {
-                solveAllPathsHelper(nx, ny, currentStep + 1);
-            }
-        }
-        // 
-        workMap[x][y] = ROAD;
-        if (!((x == startX && y == startY) || (x == endX && y == endY))) {
-            drawCell(x, y, C_VISITED);
-            updateStats(visitedCount, currentStep - 1);
-        }
-    }
+    // Ѱ·
     void solveAllPaths() {
         if (!isReady()) return;
         reset();
         totalPathCount = 0;
         visitedCount = 0;
         log("Ѱ·...");
-        solveAllPathsHelper(startX, startY, 0);
+        SolveResult r = core.solveAllPaths(this, 10);
+        totalPathCount = r.pathCount;
         if (totalPathCount == 0) log("", "Թ޽");
         else if (totalPathCount >= 10) log("", "ǰ·࣬ʾǰ10");
         else log("", "·ʾ");